@@ -10,6 +10,7 @@
 
 #pragma once
 #include <stdint.h>
+#include <string.h> //memcpy
 
 namespace SoapySDR
 {
@@ -29,28 +30,122 @@ const uint8_t   S8_FULL_SCALE =  uint8_t(1<<7);
  */
 
 // type conversion: float <> signed integers
+// Float to integer conversions saturate: a value beyond full scale clips
+// to the limit of the integer format instead of wrapping around
+// (+1.0 is one step beyond the largest value), and NaN converts to 0.
+// The limits are those of the integer format, INT32_MIN to INT32_MAX for S32,
+// and the vectorized kernels saturate to the same limits.
+// SOAPY_SDR_API_HAS_SATURATING_PRIMITIVES is defined for this behavior.
 
 inline int32_t F32toS32(float from){
-  return int32_t(from * S32_FULL_SCALE);
+  const float scaled = from * S32_FULL_SCALE;
+  if (scaled >= 2147483648.0f) return INT32_MAX;
+  if (scaled <= -2147483648.0f) return INT32_MIN;
+  if (scaled != scaled) return 0; //NaN
+  return int32_t(scaled);
 }
 inline float S32toF32(int32_t from){
   return float(from) / S32_FULL_SCALE;
 }
 
 inline int16_t F32toS16(float from){
-  return int16_t(from * S16_FULL_SCALE);
+  const float scaled = from * S16_FULL_SCALE;
+  if (scaled >= 32767.0f) return INT16_MAX;
+  if (scaled <= -32768.0f) return INT16_MIN;
+  if (scaled != scaled) return 0; //NaN
+  return int16_t(scaled);
 }
 inline float S16toF32(int16_t from){
   return float(from) / S16_FULL_SCALE;
 }
 
 inline int8_t F32toS8(float from){
-  return int8_t(from * S8_FULL_SCALE);
+  const float scaled = from * S8_FULL_SCALE;
+  if (scaled >= 127.0f) return INT8_MAX;
+  if (scaled <= -128.0f) return INT8_MIN;
+  if (scaled != scaled) return 0; //NaN
+  return int8_t(scaled);
 }
 inline float S8toF32(int8_t from){
   return float(from) / S8_FULL_SCALE;
 }
 
+// type conversion: double <> signed integers
+
+inline int32_t F64toS32(double from){
+  const double scaled = from * S32_FULL_SCALE;
+  if (scaled >= 2147483647.0) return INT32_MAX;
+  if (scaled <= -2147483648.0) return INT32_MIN;
+  if (scaled != scaled) return 0; //NaN
+  return int32_t(scaled);
+}
+inline double S32toF64(int32_t from){
+  return double(from) / S32_FULL_SCALE;
+}
+
+inline int16_t F64toS16(double from){
+  const double scaled = from * S16_FULL_SCALE;
+  if (scaled >= 32767.0) return INT16_MAX;
+  if (scaled <= -32768.0) return INT16_MIN;
+  if (scaled != scaled) return 0; //NaN
+  return int16_t(scaled);
+}
+inline double S16toF64(int16_t from){
+  return double(from) / S16_FULL_SCALE;
+}
+
+inline int8_t F64toS8(double from){
+  const double scaled = from * S8_FULL_SCALE;
+  if (scaled >= 127.0) return INT8_MAX;
+  if (scaled <= -128.0) return INT8_MIN;
+  if (scaled != scaled) return 0; //NaN
+  return int8_t(scaled);
+}
+inline double S8toF64(int8_t from){
+  return double(from) / S8_FULL_SCALE;
+}
+
+// type conversion: half precision (IEEE 754 binary16) <> float
+// F16 values are stored as uint16_t bit patterns; rounding is to nearest even.
+
+inline float F16toF32(uint16_t from){
+  const uint32_t sign = uint32_t(from & 0x8000) << 16;
+  const uint32_t exponent = (from >> 10) & 0x1f;
+  uint32_t mantissa = from & 0x3ff;
+  uint32_t bits = sign;
+  if (exponent == 0x1f) bits |= 0x7f800000 | (mantissa << 13); //inf or nan
+  else if (exponent != 0) bits |= ((exponent + 112) << 23) | (mantissa << 13);
+  else if (mantissa != 0) //subnormal: normalize into a float exponent
+  {
+    uint32_t e = 113;
+    while ((mantissa & 0x400) == 0) { mantissa <<= 1; e--; }
+    bits |= (e << 23) | ((mantissa & 0x3ff) << 13);
+  }
+  float to;
+  memcpy(&to, &bits, sizeof(to));
+  return to;
+}
+inline uint16_t F32toF16(float from){
+  uint32_t bits;
+  memcpy(&bits, &from, sizeof(bits));
+  const uint16_t sign = uint16_t((bits >> 16) & 0x8000);
+  const uint32_t absBits = bits & 0x7fffffff;
+  if (absBits > 0x7f800000) return uint16_t(sign | 0x7e00); //nan
+  if (absBits >= 0x477ff000) return uint16_t(sign | 0x7c00); //inf or overflow
+  if (absBits >= 0x38800000) //normal: rebias and round the dropped 13 bits
+  {
+    return uint16_t(sign | (((absBits + 0x0fff + ((absBits >> 13) & 1)) >> 13) - (112 << 10)));
+  }
+  if (absBits < 0x33000000) return sign; //underflow to zero
+  const uint32_t shift = 126 - (absBits >> 23); //subnormal
+  const uint32_t mantissa = (absBits & 0x7fffff) | 0x800000;
+  const uint32_t halfway = 1u << (shift - 1);
+  const uint32_t remainder = mantissa & ((1u << shift) - 1);
+  uint32_t half = mantissa >> shift;
+  if (remainder > halfway or (remainder == halfway and (half & 1) != 0)) half++;
+  return uint16_t(sign | half);
+}
+
 
 // type conversion: offset binary <> two's complement (signed) integers
 
@@ -94,6 +189,13 @@ inline int16_t S8toS16(int8_t from){
   return int16_t(from << 8);
 }
 
+inline int8_t S32toS8(int32_t from){
+  return int8_t(from >> 24);
+}
+inline int32_t S8toS32(int8_t from){
+  return int32_t(from << 24);
+}
+
 // compound conversions
 
 // float <> unsigned (type and size)
@@ -150,4 +252,82 @@ inline int8_t U16toS8(uint16_t from){
 }
 
 
+// byte order: the _BE formats hold big endian parts, which are swapped
+// to and from the host order on little endian hosts and kept as they are on big endian hosts.
+// ByteSwap16/32 always swap.
+
+//the host byte order, little endian unless the compiler reports big endian
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SOAPY_SDR_LITTLE_ENDIAN 0
+#else
+#define SOAPY_SDR_LITTLE_ENDIAN 1
+#endif
+
+inline uint16_t ByteSwap16(uint16_t from){
+  return uint16_t((from << 8) | (from >> 8));
+}
+inline uint32_t ByteSwap32(uint32_t from){
+  return (from << 24) | ((from << 8) & 0x00ff0000) | ((from >> 8) & 0x0000ff00) | (from >> 24);
+}
+
+inline uint16_t BE16toHost(uint16_t from){
+  return SOAPY_SDR_LITTLE_ENDIAN?ByteSwap16(from):from;
+}
+inline uint32_t BE32toHost(uint32_t from){
+  return SOAPY_SDR_LITTLE_ENDIAN?ByteSwap32(from):from;
+}
+
+inline int16_t S16BEtoS16(uint16_t from){
+  return int16_t(BE16toHost(from));
+}
+inline uint16_t S16toS16BE(int16_t from){
+  return BE16toHost(uint16_t(from));
+}
+
+// big endian floats are swapped as 32-bit words, a swapped pattern is never held as a float:
+// it may be a signaling NaN, which some floating point paths would quiet or change
+
+inline float F32BEtoF32(uint32_t from){
+  const uint32_t bits = BE32toHost(from);
+  float to;
+  memcpy(&to, &bits, sizeof(to));
+  return to;
+}
+inline uint32_t F32toF32BE(float from){
+  uint32_t bits;
+  memcpy(&bits, &from, sizeof(bits));
+  return BE32toHost(bits);
+}
+
+// packed 12-bit complex: one I/Q pair in 3 bytes, little endian,
+// I in the low 12 bits and Q in the high 12 bits.
+// Values are left-justified to 16 bits so the full scale matches CS16.
+// Offset binary (CU12) uses the same bit layout as CU16.
+
+inline void CS12toCS16(const uint8_t *from, int16_t &i, int16_t &q){
+  i = int16_t(uint16_t(from[1] << 12) | uint16_t(from[0] << 4));
+  q = int16_t(uint16_t(from[2] << 8) | uint16_t(from[1] & 0xf0));
+}
+inline void CS16toCS12(int16_t i, int16_t q, uint8_t *to){
+  to[0] = uint8_t(uint16_t(i) >> 4);
+  to[1] = uint8_t((uint16_t(q) & 0xf0) | (uint16_t(i) >> 12));
+  to[2] = uint8_t(uint16_t(q) >> 8);
+}
+
+// packed 4-bit complex: one I/Q pair in 1 byte,
+// I in the low nibble and Q in the high nibble.
+// Values are left-justified to 8 bits so the full scale matches CS8.
+// Offset binary (CU4) flips the top bit of each nibble.
+
+const uint8_t U4_ZERO_OFFSET = uint8_t(0x88);
+
+inline void CS4toCS8(uint8_t from, int8_t &i, int8_t &q){
+  i = int8_t(uint8_t(from << 4));
+  q = int8_t(from & 0xf0);
+}
+inline uint8_t CS8toCS4(int8_t i, int8_t q){
+  return uint8_t((uint8_t(i) >> 4) | (uint8_t(q) & 0xf0));
+}
+
+
 }
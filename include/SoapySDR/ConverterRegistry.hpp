@@ -13,7 +13,9 @@
 #include <SoapySDR/Config.hpp>
 #include <SoapySDR/Logger.hpp>
 #include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Types.hpp>
 #include <utility>
+#include <complex>
 #include <vector>
 #include <map>
 #include <string>
@@ -41,15 +43,54 @@ namespace SoapySDR
      */
     typedef void (*ConverterFunction)(const void *, void *, const size_t, const double);
 
+    /*!
+     * StatefulFunctions: the functions of a converter that keeps a context between calls,
+     * such as dither generator state, filter history, or precomputed tables.
+     * Each Converter handle creates its own context from its arguments,
+     * so every stream converts with independent state.
+     * A context belongs to one stream of samples: convert() is called
+     * from one thread at a time, with the buffers of the stream in order.
+     */
+    struct StatefulFunctions
+    {
+      //! Create a context from the converter arguments
+      void *(*create)(const Kwargs &args);
+
+      //! Convert a buffer with the context; the other parameters are those of a ConverterFunction
+      void (*convert)(void *context, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler);
+
+      //! Return the context to its initial state, such as after a stream discontinuity
+      void (*reset)(void *context);
+
+      //! Destroy a context made by create()
+      void (*destroy)(void *context);
+    };
+
     /*!
      * FunctionPriority: allow selection of a converter function with a given source and target format.
      */
     enum FunctionPriority{
-      GENERIC = 0,          //!< Usual C for-loops, shifts, multiplies, etc. Min priority.
+      DITHERED = -1,        //!< Dithered narrowing with per-converter noise state. Never selected by default.
+      GENERIC = 0,          //!< Usual C for-loops, shifts, multiplies, etc. Min default priority.
       VECTORIZED = 3,       //!< Vectorized operations such as SIMD.
       CUSTOM = 5            //!< Custom user re-implementation. Max priority.
     };
 
+    /*!
+     * InstructionSet: the CPU instruction set extension required by a converter function.
+     * Several functions may be registered for the same source/target/priority,
+     * one per instruction set; the registry selects the widest instruction set
+     * supported by the running CPU (see getInstructionSet()).
+     * Each level implies support for all of the lower levels.
+     */
+    enum InstructionSet{
+      ISA_GENERIC = 0,      //!< No special requirements, runs on any CPU.
+      ISA_SSE2 = 1,         //!< x86 SSE2.
+      ISA_SSE41 = 2,        //!< x86 SSE4.1 and SSSE3.
+      ISA_AVX2 = 3,         //!< x86 AVX2, FMA, and F16C.
+      ISA_AVX512 = 4        //!< x86 AVX-512 F, BW, and VL.
+    };
+
     /*!
      * TargetFormatConverterPriority: a map of possible conversion functions for a given Priority.
      * Maintained by the registry.
@@ -79,6 +120,34 @@ namespace SoapySDR
      * \param converter function to register
      */
     ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter);
+
+    /*!
+     * Class constructor. Registers a ConverterFunction with a
+     * given source format, target format, priority, and instruction set.
+     * The function is only selected when the running CPU supports the instruction set.
+     *
+     * refuses to register converter and logs error if a source/target/priority/instruction set entry already exists
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter to register
+     * \param converter function to register
+     * \param isa the instruction set required by the converter function
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter, const InstructionSet isa);
+
+    /*!
+     * Class constructor. Registers StatefulFunctions with a
+     * given source format, target format, and priority.
+     * Stateful converters are used through a Converter handle;
+     * getFunction() and the format listings only cover stateless functions.
+     *
+     * refuses to register converter and logs error if a stateful source/target/priority entry already exists
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter to register
+     * \param functions the stateful functions to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const StatefulFunctions &functions);
     
     /*!
      * Get a list of existing target formats to which we can convert the specified source from.
@@ -126,6 +195,321 @@ namespace SoapySDR
      */
     static std::vector<std::string> listAvailableSourceFormats(void);
 
+    /*!
+     * Get the instruction set used to select converter functions.
+     * This is the widest instruction set supported by the running CPU,
+     * unless limited by the SOAPY_SDR_CONVERTER_ISA environment variable
+     * (one of generic, sse2, sse4.1, avx2, avx512).
+     */
+    static InstructionSet getInstructionSet(void);
+
+    /*!
+     * Get a list of the instruction sets available for a given source, target, and priority.
+     * Only instruction sets usable on this host (see getInstructionSet()) are listed.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter
+     * \return a vector of instruction sets or an empty vector if none found
+     */
+    static std::vector<InstructionSet> listInstructionSets(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Get a converter between a source and target format with a given priority and instruction set.
+     * \throws runtime_error when the conversion does not exist or is not usable on this host
+     */
+    static ConverterFunction getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const InstructionSet &isa);
+
+    /*!
+     * Get the fastest priority for a source and target format at a given buffer size.
+     * getFunction() picks the highest priority, which is not always the fastest,
+     * such as for small buffers on some CPUs. This measures each registered priority
+     * converting buffers of the given size (such as the stream MTU) and returns the fastest;
+     * a lower priority is only chosen when it is clearly faster than the highest.
+     * Pass the result to getFunction() or to the Converter constructor.
+     *
+     * Decisions are cached in memory and appended to a per-host cache file,
+     * so later process starts skip the measurement. The file is
+     * converters-<hostname>.cache in the SoapySDR directory of the user cache
+     * ($XDG_CACHE_HOME, ~/.cache, or %LOCALAPPDATA%), or the path in the
+     * SOAPY_SDR_CONVERTER_CACHE environment variable. Decisions are kept per
+     * library version and instruction set (see getInstructionSet()).
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param numElems the number of elements converted per call
+     * \return the fastest priority
+     */
+    static FunctionPriority tunePriority(const std::string &sourceFormat, const std::string &targetFormat, const size_t numElems);
+
+    /*!
+     * Find a chain of registered conversions from a source to a target format.
+     * The path has the fewest hops (at most 3); among those, the path whose
+     * narrowest intermediate format is the widest is chosen.
+     * Planar formats are only converted directly, never along a path.
+     * Paths are cached until the next converter registration.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return the formats along the path, starting with the source format
+     * and ending with the target format, or an empty vector if none found
+     */
+    static std::vector<std::string> findPath(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a list of available stateful converter priorities for a given source and target format.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return a vector of priorities or an empty vector if none found
+     */
+    static std::vector<FunctionPriority> listStatefulPriorities(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get the stateful converter between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     */
+    static StatefulFunctions getStatefulFunctions(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
   };
-  
+
+  /*!
+   * Converter class. A Converter resolves a ConverterFunction once
+   * from a source format, target format, and optional priority,
+   * and caches the function along with the element size and depth of each format.
+   * Code that converts on every buffer can hold a Converter
+   * rather than looking up the registry for every call.
+   *
+   * When no direct conversion is registered, a Converter without a priority
+   * chains the conversions found by ConverterRegistry::findPath().
+   * A chained conversion runs in cache-sized chunks through internal
+   * staging buffers, so the intermediate formats stay in cache.
+   *
+   * A Converter resolved to StatefulFunctions owns a context created from its arguments.
+   * A copy of the Converter creates its own context, starting from the initial state.
+   * Stateless functions are the degenerate case without a context.
+   *
+   * The conversion calls are const because they do not change the resolved conversion,
+   * but the calls of a stateful Converter update its context.
+   * A stateful Converter is therefore not thread-safe and can not be shared:
+   * it should only convert from one thread at a time, and only one stream of samples.
+   * The calls of the Converter keep to this rule: a buffer is always converted in order,
+   * convertParallel() converts on the calling thread, and convertBatch() throws,
+   * since its channels are separate streams.
+   */
+  class SOAPY_SDR_API Converter
+  {
+  public:
+    //! Create an empty converter; isValid() is false until assigned
+    Converter(void);
+
+    /*!
+     * Create a converter with the highest available priority.
+     * A stateless function is preferred over stateful functions of the same priority.
+     * Without a direct conversion, the converter chains
+     * the highest priority conversions along a path of formats.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param args arguments to create the context of stateful functions
+     */
+    Converter(const std::string &sourceFormat, const std::string &targetFormat, const Kwargs &args = Kwargs());
+
+    /*!
+     * Create a converter with a given priority.
+     * A stateless function is preferred over stateful functions of the same priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter
+     * \param args arguments to create the context of stateful functions
+     */
+    Converter(const std::string &sourceFormat, const std::string &targetFormat, const ConverterRegistry::FunctionPriority &priority, const Kwargs &args = Kwargs());
+
+    //! Create a converter with the same conversion and a fresh context
+    Converter(const Converter &other);
+
+    //! Move a converter along with its context
+    Converter(Converter &&other);
+
+    //! Destroy the context of stateful functions
+    ~Converter(void);
+
+    //! Assign the same conversion with a fresh context
+    Converter &operator=(const Converter &other);
+
+    //! Move assign a converter along with its context
+    Converter &operator=(Converter &&other);
+
+    //! Is this converter resolved to a function or a path?
+    bool isValid(void) const
+    {
+      return _function != nullptr or _stateful.convert != nullptr or not _hopFunctions.empty();
+    }
+
+    //! Is this converter resolved to stateful functions?
+    bool isStateful(void) const
+    {
+      return _stateful.convert != nullptr;
+    }
+
+    //! Get the source format markup string
+    const std::string &getSourceFormat(void) const
+    {
+      return _sourceFormat;
+    }
+
+    //! Get the target format markup string
+    const std::string &getTargetFormat(void) const
+    {
+      return _targetFormat;
+    }
+
+    //! Get the priority of the resolved function (the lowest priority along a path)
+    ConverterRegistry::FunctionPriority getPriority(void) const
+    {
+      return _priority;
+    }
+
+    //! Get the resolved conversion function pointer, nullptr for stateful functions or a path of conversions
+    ConverterRegistry::ConverterFunction getFunction(void) const
+    {
+      return _function;
+    }
+
+    //! Get the formats along the conversion, from the source to the target format
+    const std::vector<std::string> &getPath(void) const
+    {
+      return _path;
+    }
+
+    //! Get the size of a source element in bytes
+    size_t getSourceElementSize(void) const
+    {
+      return _sourceElemSize;
+    }
+
+    //! Get the size of a target element in bytes
+    size_t getTargetElementSize(void) const
+    {
+      return _targetElemSize;
+    }
+
+    //! Get the number of parts in a source element (2 for complex formats, 1 for real)
+    size_t getSourceElementDepth(void) const
+    {
+      return _sourceElemDepth;
+    }
+
+    //! Get the number of parts in a target element (2 for complex formats, 1 for real)
+    size_t getTargetElementDepth(void) const
+    {
+      return _targetElemDepth;
+    }
+
+    /*!
+     * Convert a buffer with the resolved function.
+     * Stateful functions continue from the context left by the previous call.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param scaler an optional scale factor
+     */
+    void convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler = 1.0) const
+    {
+      if (_function != nullptr) _function(srcBuff, dstBuff, numElems, scaler);
+      else if (_stateful.convert != nullptr) _stateful.convert(_context, srcBuff, dstBuff, numElems, scaler);
+      else this->convertPath(srcBuff, dstBuff, numElems, scaler);
+    }
+
+    /*!
+     * Convert a buffer with a complex scale factor,
+     * which applies a gain and a phase rotation along with the conversion.
+     * The buffer is converted and rotated in cache-sized chunks of CF32,
+     * so either the source or the target format must be CF32.
+     * \throws runtime_error when neither format is CF32, also for a real valued scaler
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param scaler the complex scale factor
+     */
+    void convert(const void *srcBuff, void *dstBuff, const size_t numElems, const std::complex<double> &scaler) const;
+
+    /*!
+     * Convert a buffer for each channel with a complex scale factor per channel,
+     * such as the gain and phase calibration of each channel of an array.
+     * Stateful functions are not supported; use one Converter per channel instead.
+     * \throws runtime_error when neither format is CF32 or the converter is stateful
+     * \param srcBuffs an array of input buffers in the source format, one per channel
+     * \param dstBuffs an array of output buffers in the target format, one per channel
+     * \param numChans the number of channels (the size of each array)
+     * \param numElems the number of elements to convert in each channel
+     * \param scalers an array of complex scale factors, one per channel
+     */
+    void convertBatch(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const std::complex<double> *scalers) const;
+
+    /*!
+     * Return the context of stateful functions to its initial state,
+     * such as after an overflow or at the start of a new burst.
+     * Does nothing for stateless functions.
+     */
+    void reset(void)
+    {
+      if (_stateful.reset != nullptr) _stateful.reset(_context);
+    }
+
+    /*!
+     * Convert a buffer for each channel with the resolved function.
+     * The buffer arrays follow the layout of Device::readStream() and Device::writeStream().
+     * Stateful functions are not supported, since the channels would share one context;
+     * use one Converter per channel instead.
+     * \throws runtime_error when the converter is stateful
+     * \param srcBuffs an array of input buffers in the source format, one per channel
+     * \param dstBuffs an array of output buffers in the target format, one per channel
+     * \param numChans the number of channels (the size of each buffer array)
+     * \param numElems the number of elements to convert in each channel
+     * \param scalers an array of scale factors, one per channel, or nullptr for no scaling
+     */
+    void convertBatch(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double *scalers = nullptr) const;
+
+    /*!
+     * Convert a large buffer in parallel, such as a recording or a capture.
+     * The buffer is split into chunks that start on a cache line in both buffers,
+     * and the resolved function converts the chunks concurrently on a shared
+     * pool of worker threads. The calling thread converts chunks as well,
+     * and returns when the whole buffer is converted.
+     * Concurrent calls share the pool; a call never waits for the buffer of another call.
+     * Stateful functions and small buffers are converted on the calling thread.
+     * If the conversion of a chunk throws, the remaining chunks are skipped
+     * and the exception is thrown to the caller once the workers are done.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param scaler an optional scale factor
+     * \param numThreads the maximum number of threads including the caller, 0 for one per CPU core
+     */
+    void convertParallel(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler = 1.0, const size_t numThreads = 0) const;
+
+  private:
+    void convertPath(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler) const;
+    void resolveStateful(const ConverterRegistry::FunctionPriority &priority);
+
+    std::string _sourceFormat;
+    std::string _targetFormat;
+    ConverterRegistry::FunctionPriority _priority;
+    ConverterRegistry::ConverterFunction _function;
+    size_t _sourceElemSize;
+    size_t _targetElemSize;
+    size_t _sourceElemDepth;
+    size_t _targetElemDepth;
+
+    //stateful functions and the context owned by this converter
+    Kwargs _args;
+    ConverterRegistry::StatefulFunctions _stateful;
+    void *_context;
+
+    //chained conversions when there is no direct function
+    std::vector<std::string> _path;
+    std::vector<ConverterRegistry::ConverterFunction> _hopFunctions;
+    size_t _scalerHop;
+    size_t _chunkElems;
+  };
+
 }
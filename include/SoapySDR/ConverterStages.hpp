@@ -0,0 +1,336 @@
+///
+/// \file SoapySDR/ConverterStages.hpp
+///
+/// Converters fused with common stream processing stages.
+///
+/// \copyright
+/// Copyright (c) 2026 SoapySDR contributors
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <complex>
+#include <string>
+#include <vector>
+
+namespace SoapySDR
+{
+  /*!
+   * IQCorrectionConverter class. Converts a complex source format to CF32.
+   * In the same pass, it removes the DC offset and corrects the IQ imbalance.
+   * Each chunk of samples is converted into the output buffer by the registry,
+   * then corrected in place while it is still in cache.
+   *
+   * DC removal subtracts an offset from each sample. IQ correction applies
+   * y = x + balance*conj(x), a 2x2 real matrix on the I and Q parts.
+   * In automatic mode, the offset tracks the mean of the input, and the
+   * balance adapts to make the output circular (no image component).
+   *
+   * This is a software fallback for drivers without frontend corrections,
+   * see Device::hasDCOffset() and Device::hasIQBalance().
+   * The settings mirror the Device corrections API, so a driver can hold
+   * one converter per receive channel and forward the calls to it.
+   * A converter converts one stream of samples, from one thread at a time.
+   */
+  class SOAPY_SDR_API IQCorrectionConverter
+  {
+  public:
+
+    /*!
+     * Create a correcting converter with corrections disabled.
+     * \throws runtime_error when the conversion to CF32 does not exist
+     * \param sourceFormat the complex source format markup string
+     */
+    IQCorrectionConverter(const std::string &sourceFormat);
+
+    //! Get the converter used for the source format
+    const Converter &getConverter(void) const
+    {
+      return _converter;
+    }
+
+    //! Set the automatic DC offset correction mode
+    void setDCOffsetMode(const bool automatic);
+
+    //! Get the automatic DC offset correction mode
+    bool getDCOffsetMode(void) const
+    {
+      return _dcOffsetMode;
+    }
+
+    /*!
+     * Set the DC offset subtracted from each sample (after scaling, 1.0 max).
+     * In automatic mode, this sets the starting point of the estimate.
+     */
+    void setDCOffset(const std::complex<double> &offset);
+
+    //! Get the DC offset subtracted from each sample, the current estimate in automatic mode
+    std::complex<double> getDCOffset(void) const
+    {
+      return _dcOffset;
+    }
+
+    //! Set the automatic IQ balance correction mode
+    void setIQBalanceMode(const bool automatic);
+
+    //! Get the automatic IQ balance correction mode
+    bool getIQBalanceMode(void) const
+    {
+      return _iqBalanceMode;
+    }
+
+    /*!
+     * Set the IQ balance correction (1.0 max).
+     * In automatic mode, this sets the starting point of the estimate.
+     */
+    void setIQBalance(const std::complex<double> &balance);
+
+    //! Get the IQ balance correction, the current estimate in automatic mode
+    std::complex<double> getIQBalance(void) const
+    {
+      return _iqBalance;
+    }
+
+    /*!
+     * Set the number of samples that the automatic corrections average over.
+     * Longer tracking gives steadier estimates but adapts more slowly.
+     * \param numElems the tracking length in elements (default 65536)
+     */
+    void setTrackingLength(const size_t numElems);
+
+    //! Get the number of samples that the automatic corrections average over
+    size_t getTrackingLength(void) const
+    {
+      return _trackingLength;
+    }
+
+    /*!
+     * Restart the automatic estimates from zero,
+     * such as after retuning or an overflow.
+     * Manual corrections are not changed.
+     * The context of a stateful registry converter is reset as well.
+     */
+    void reset(void);
+
+    /*!
+     * Convert and correct a buffer.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in CF32
+     * \param numElems the number of elements to convert
+     * \param scaler an optional scale factor for the conversion
+     */
+    void convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler = 1.0);
+
+  private:
+    Converter _converter;
+    bool _dcOffsetMode;
+    bool _iqBalanceMode;
+    std::complex<double> _dcOffset;
+    std::complex<double> _iqBalance;
+    size_t _trackingLength;
+  };
+
+  /*!
+   * MixerConverter class. Converts a buffer and shifts its frequency
+   * with a numerically controlled oscillator (NCO) in the same pass.
+   * The mixer multiplies each CF32 sample by exp(j*phase),
+   * where the phase advances by 2*pi*frequency per sample and carries over between calls.
+   * The mixer runs on the CF32 side of the conversion, in cache-sized chunks:
+   * after the conversion for a CF32 target, before the conversion for a CF32 source.
+   *
+   * This is a software mixer for offset tuning on devices without
+   * a baseband CORDIC, see the OFFSET argument of Device::setFrequency().
+   * A converter converts one stream of samples, from one thread at a time.
+   */
+  class SOAPY_SDR_API MixerConverter
+  {
+  public:
+
+    /*!
+     * Create a mixing converter with a zero frequency.
+     * \throws runtime_error when the conversion does not exist or neither format is CF32
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     */
+    MixerConverter(const std::string &sourceFormat, const std::string &targetFormat = SOAPY_SDR_CF32);
+
+    //! Get the converter used between the formats
+    const Converter &getConverter(void) const
+    {
+      return _converter;
+    }
+
+    /*!
+     * Set the mixing frequency relative to the sample rate.
+     * For example, to remove an offset of 1 MHz at 10 Msps, use -0.1.
+     * \param frequency the frequency in cycles per sample (-0.5 to 0.5)
+     */
+    void setFrequency(const double frequency);
+
+    //! Get the mixing frequency in cycles per sample
+    double getFrequency(void) const
+    {
+      return _frequency;
+    }
+
+    //! Set the oscillator phase in radians for the next sample
+    void setPhase(const double phase);
+
+    //! Get the oscillator phase in radians for the next sample
+    double getPhase(void) const
+    {
+      return _phase;
+    }
+
+    //! Reset the oscillator phase to zero and the context of a stateful registry converter, such as at the start of a new stream
+    void reset(void);
+
+    /*!
+     * Convert and mix a buffer.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param scaler an optional scale factor for the conversion
+     */
+    void convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler = 1.0);
+
+  private:
+    Converter _converter;
+    double _frequency;
+    double _phase;
+  };
+
+  /*!
+   * DecimatingConverter class. Converts a complex source format to CF32
+   * and decimates it by an integer factor in the same pass.
+   * Each chunk of samples is converted directly into the filter history,
+   * so only the decimated output is written to the output buffer.
+   *
+   * The factor is split into an odd part and a power of two.
+   * The odd part uses a CIC-shaped FIR filter (4th order) at the input rate.
+   * Each factor of two uses a 31-tap half-band filter, which passes 60% of the
+   * output bandwidth with more than 85 dB of alias rejection.
+   * Odd factors without a half-band stage have the droop and
+   * the weaker (about 40 dB) alias rejection of a CIC filter.
+   * The filter history carries over between calls.
+   * A converter converts one stream of samples, from one thread at a time.
+   */
+  class SOAPY_SDR_API DecimatingConverter
+  {
+  public:
+
+    /*!
+     * Create a decimating converter.
+     * \throws runtime_error when the conversion to CF32 does not exist or the factor is zero
+     * \param sourceFormat the complex source format markup string
+     * \param factor the decimation factor, 1 for none
+     */
+    DecimatingConverter(const std::string &sourceFormat, const size_t factor);
+
+    //! Get the converter used for the source format
+    const Converter &getConverter(void) const
+    {
+      return _converter;
+    }
+
+    //! Get the decimation factor
+    size_t getFactor(void) const
+    {
+      return _factor;
+    }
+
+    //! Clear the filter history and the context of a stateful registry converter, such as at the start of a new stream
+    void reset(void);
+
+    /*!
+     * Convert and decimate a buffer.
+     * Over the life of the converter, N input elements produce ceil(N/factor) output elements.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in CF32, at least ceil(numElems/factor) elements
+     * \param numElems the number of input elements to convert
+     * \param scaler an optional scale factor for the conversion
+     * \return the number of output elements written
+     */
+    size_t convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler = 1.0);
+
+  private:
+    struct Stage
+    {
+      size_t factor;
+      std::vector<float> taps; //empty for a half-band stage
+      std::vector<float> buffer; //CF32 input history
+      size_t numElems; //elements in the history
+    };
+    Converter _converter;
+    size_t _factor;
+    std::vector<Stage> _stages;
+  };
+
+  /*!
+   * SaturatingConverter class. Narrows samples to a smaller format,
+   * clipping out of range values to the limits of the target format
+   * instead of wrapping them, and counts the clipped values in the same pass.
+   * The count is a cheap overload indicator for transmitting near full scale.
+   *
+   * The supported conversions are F32 to S16, S8, and U8, and S16 to S8,
+   * in both the real and complex (CF32, CS16, CS8, CU8) formats.
+   * The scaling matches the registry converters for the same formats.
+   * A converter should only convert from one thread at a time.
+   */
+  class SOAPY_SDR_API SaturatingConverter
+  {
+  public:
+
+    /*!
+     * Create a saturating converter.
+     * \throws runtime_error when the conversion is not supported
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     */
+    SaturatingConverter(const std::string &sourceFormat, const std::string &targetFormat);
+
+    //! Get the source format markup string
+    const std::string &getSourceFormat(void) const
+    {
+      return _sourceFormat;
+    }
+
+    //! Get the target format markup string
+    const std::string &getTargetFormat(void) const
+    {
+      return _targetFormat;
+    }
+
+    /*!
+     * Get the number of values clipped since creation or the last reset.
+     * For complex formats, the I and Q parts are counted separately.
+     */
+    unsigned long long getClipCount(void) const
+    {
+      return _clipCount;
+    }
+
+    //! Reset the clip count to zero
+    void resetClipCount(void);
+
+    /*!
+     * Convert a buffer with saturation.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     * \param scaler an optional scale factor for the conversion
+     * \return the number of values clipped in this buffer
+     */
+    size_t convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler = 1.0);
+
+  private:
+    std::string _sourceFormat;
+    std::string _targetFormat;
+    size_t _numParts;
+    int _kernel;
+    unsigned long long _clipCount;
+  };
+
+}
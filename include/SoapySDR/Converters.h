@@ -27,7 +27,10 @@ typedef void (*SoapySDRConverterFunction)(const void *, void *, const size_t, co
  */
 typedef enum
 {
-    //! Usual C for-loops, shifts, multiplies, etc. Min priority.
+    //! Dithered narrowing with per-converter noise state. Never selected by default.
+    SOAPY_SDR_CONVERTER_DITHERED = -1,
+
+    //! Usual C for-loops, shifts, multiplies, etc. Min default priority.
     SOAPY_SDR_CONVERTER_GENERIC = 0,
 
     //! Vectorized configurations such as SIMD.
@@ -37,6 +40,36 @@ typedef enum
     SOAPY_SDR_CONVERTER_CUSTOM = 5
 } SoapySDRConverterFunctionPriority;
 
+/*!
+ * The CPU instruction set extension required by a converter function.
+ * Each level implies support for all of the lower levels.
+ */
+typedef enum
+{
+    //! No special requirements, runs on any CPU.
+    SOAPY_SDR_CONVERTER_ISA_GENERIC = 0,
+
+    //! x86 SSE2.
+    SOAPY_SDR_CONVERTER_ISA_SSE2 = 1,
+
+    //! x86 SSE4.1 and SSSE3.
+    SOAPY_SDR_CONVERTER_ISA_SSE41 = 2,
+
+    //! x86 AVX2, FMA, and F16C.
+    SOAPY_SDR_CONVERTER_ISA_AVX2 = 3,
+
+    //! x86 AVX-512 F, BW, and VL.
+    SOAPY_SDR_CONVERTER_ISA_AVX512 = 4
+} SoapySDRConverterInstructionSet;
+
+/*!
+ * A converter handle resolved once from a source format, target format, and priority.
+ * The handle caches the conversion function and the element size of each format.
+ * A handle to stateful functions updates its context on every conversion call,
+ * so it is not thread-safe and should only convert one stream of samples.
+ */
+typedef struct SoapySDRConverter SoapySDRConverter;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -90,6 +123,190 @@ SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriorit
  */
 SOAPY_SDR_API char **SoapySDRConverter_listAvailableSourceFormats(size_t *length);
 
+/*!
+ * Get the instruction set used to select converter functions.
+ * This is the widest instruction set supported by the running CPU,
+ * unless limited by the SOAPY_SDR_CONVERTER_ISA environment variable
+ * (one of generic, sse2, sse4.1, avx2, avx512).
+ * \return the active instruction set
+ */
+SOAPY_SDR_API SoapySDRConverterInstructionSet SoapySDRConverter_getInstructionSet(void);
+
+/*!
+ * Get a list of the instruction sets available for a given source, target, and priority.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param priority the converter priority
+ * \param [out] length the number of instruction sets
+ * \return a list of instruction sets or nullptr if none are found
+ */
+SOAPY_SDR_API SoapySDRConverterInstructionSet *SoapySDRConverter_listInstructionSets(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, size_t *length);
+
+/*!
+ * Get a converter between a source and target format with a given priority and instruction set.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param priority the converter priority
+ * \param isa the instruction set
+ * \return a conversion function pointer or nullptr if none are found
+ */
+SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunctionWithInstructionSet(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, const SoapySDRConverterInstructionSet isa);
+
+/*!
+ * Get the fastest priority for a source and target format at a given buffer size.
+ * Each registered priority is measured at the buffer size (such as the stream MTU),
+ * and the decision is cached in a per-host file for later process starts.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param numElems the number of elements converted per call
+ * \param [out] priority the fastest priority
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_tunePriority(const char *sourceFormat, const char *targetFormat, const size_t numElems, SoapySDRConverterFunctionPriority *priority);
+
+/*!
+ * Create a converter handle with the highest available priority.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \return a converter handle or nullptr if the conversion is not found
+ */
+SOAPY_SDR_API SoapySDRConverter *SoapySDRConverter_make(const char *sourceFormat, const char *targetFormat);
+
+/*!
+ * Create a converter handle with a given priority.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param priority the converter priority
+ * \return a converter handle or nullptr if the conversion is not found
+ */
+SOAPY_SDR_API SoapySDRConverter *SoapySDRConverter_makeWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority);
+
+/*!
+ * Create a converter handle with the highest available priority,
+ * passing arguments to create the context of stateful converters.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param args arguments for the converter context
+ * \return a converter handle or nullptr if the conversion is not found
+ */
+SOAPY_SDR_API SoapySDRConverter *SoapySDRConverter_makeWithArgs(const char *sourceFormat, const char *targetFormat, const SoapySDRKwargs *args);
+
+/*!
+ * Destroy a converter handle created by SoapySDRConverter_make().
+ * \param converter a converter handle
+ */
+SOAPY_SDR_API void SoapySDRConverter_unmake(SoapySDRConverter *converter);
+
+/*!
+ * Convert a buffer with the function resolved by the handle.
+ * \param converter a converter handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ * \param scaler a scale factor (1.0 for none)
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_convert(const SoapySDRConverter *converter, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler);
+
+/*!
+ * Convert a buffer for each channel with the function resolved by the handle.
+ * The buffer arrays follow the layout of SoapySDRDevice_readStream() and SoapySDRDevice_writeStream().
+ * Stateful functions are not supported, since the channels would share one context;
+ * use one converter handle per channel instead.
+ * \param converter a converter handle
+ * \param srcBuffs an array of input buffers in the source format, one per channel
+ * \param dstBuffs an array of output buffers in the target format, one per channel
+ * \param numChans the number of channels (the size of each buffer array)
+ * \param numElems the number of elements to convert in each channel
+ * \param scalers an array of scale factors, one per channel, or nullptr for no scaling
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_convertBatch(const SoapySDRConverter *converter, const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double *scalers);
+
+/*!
+ * Convert a large buffer in parallel slices on a shared pool of worker threads.
+ * Stateful converters and small buffers are converted on the calling thread.
+ * \param converter a converter handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ * \param scaler a scale factor (1.0 for none)
+ * \param numThreads the maximum number of threads including the caller, 0 for one per CPU core
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_convertParallel(const SoapySDRConverter *converter, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, const size_t numThreads);
+
+/*!
+ * Convert a buffer with a complex scale factor,
+ * which applies a gain and a phase rotation along with the conversion.
+ * Either the source or the target format must be CF32.
+ * \param converter a converter handle
+ * \param srcBuff the input buffer in the source format
+ * \param dstBuff the output buffer in the target format
+ * \param numElems the number of elements to convert
+ * \param scalerReal the real part of the scale factor
+ * \param scalerImag the imaginary part of the scale factor
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_convertComplex(const SoapySDRConverter *converter, const void *srcBuff, void *dstBuff, const size_t numElems, const double scalerReal, const double scalerImag);
+
+/*!
+ * Convert a buffer for each channel with a complex scale factor per channel.
+ * Either the source or the target format must be CF32.
+ * Stateful functions are not supported; use one converter handle per channel instead.
+ * \param converter a converter handle
+ * \param srcBuffs an array of input buffers in the source format, one per channel
+ * \param dstBuffs an array of output buffers in the target format, one per channel
+ * \param numChans the number of channels (the size of each buffer array)
+ * \param numElems the number of elements to convert in each channel
+ * \param scalers the complex scale factors as real and imaginary pairs, one pair per channel
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_convertBatchComplex(const SoapySDRConverter *converter, const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double *scalers);
+
+/*!
+ * Return the context of a stateful converter to its initial state.
+ * Does nothing for stateless converters.
+ * \param converter a converter handle
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_reset(SoapySDRConverter *converter);
+
+/*!
+ * Get the conversion function resolved by the handle.
+ * \param converter a converter handle
+ * \return the conversion function pointer
+ */
+SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getHandleFunction(const SoapySDRConverter *converter);
+
+/*!
+ * Get the size of a source element in bytes.
+ * \param converter a converter handle
+ * \return the source element size
+ */
+SOAPY_SDR_API size_t SoapySDRConverter_getSourceElementSize(const SoapySDRConverter *converter);
+
+/*!
+ * Get the size of a target element in bytes.
+ * \param converter a converter handle
+ * \return the target element size
+ */
+SOAPY_SDR_API size_t SoapySDRConverter_getTargetElementSize(const SoapySDRConverter *converter);
+
+/*!
+ * Get the number of parts in a source element (2 for complex formats, 1 for real).
+ * \param converter a converter handle
+ * \return the source element depth
+ */
+SOAPY_SDR_API size_t SoapySDRConverter_getSourceElementDepth(const SoapySDRConverter *converter);
+
+/*!
+ * Get the number of parts in a target element (2 for complex formats, 1 for real).
+ * \param converter a converter handle
+ * \return the target element depth
+ */
+SOAPY_SDR_API size_t SoapySDRConverter_getTargetElementDepth(const SoapySDRConverter *converter);
+
 #ifdef __cplusplus
 }
 #endif
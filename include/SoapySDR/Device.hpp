@@ -556,6 +556,10 @@ public:
 
     /*******************************************************************
      * Frontend corrections API
+     *
+     * Drivers without frontend corrections may apply them in software
+     * with the SoapySDR::IQCorrectionConverter (ConverterStages.hpp)
+     * when converting receive buffers.
      ******************************************************************/
 
     /*!
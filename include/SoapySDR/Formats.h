@@ -18,6 +18,9 @@
 //! Complex 32-bit floats (complex float)
 #define SOAPY_SDR_CF32 "CF32"
 
+//! Complex 16-bit floats (complex IEEE 754 half precision)
+#define SOAPY_SDR_CF16 "CF16"
+
 //! Complex signed 32-bit integers (complex int32)
 #define SOAPY_SDR_CS32 "CS32"
 
@@ -42,18 +45,49 @@
 //! Complex unsigned 8-bit integers (complex uint8)
 #define SOAPY_SDR_CU8 "CU8"
 
-//! Complex signed 4-bit integers (1 byte)
+//! Complex signed 4-bit integers (1 byte, I in the low nibble, Q in the high nibble)
 #define SOAPY_SDR_CS4 "CS4"
 
-//! Complex unsigned 4-bit integers (1 byte)
+//! Complex unsigned 4-bit integers (1 byte, I in the low nibble, Q in the high nibble)
 #define SOAPY_SDR_CU4 "CU4"
 
+/*!
+ * Wire format variants of the complex formats.
+ * The _BE suffix marks big endian parts,
+ * the _QI suffix marks the Q part before the I part.
+ */
+
+//! Complex 32-bit floats with big endian parts
+#define SOAPY_SDR_CF32_BE "CF32_BE"
+
+//! Complex signed 16-bit integers with big endian parts
+#define SOAPY_SDR_CS16_BE "CS16_BE"
+
+//! Complex signed 16-bit integers with Q before I
+#define SOAPY_SDR_CS16_QI "CS16_QI"
+
+//! Complex signed 8-bit integers with Q before I
+#define SOAPY_SDR_CS8_QI "CS8_QI"
+
+/*!
+ * Planar variants of the complex formats.
+ * The I and Q parts are held in separate buffers, so the buffer
+ * passed for a _PLANAR format is an array of 2 plane pointers (I, Q),
+ * and the number of elements is the number of parts in each plane.
+ */
+
+//! Complex 32-bit floats split into I and Q planes
+#define SOAPY_SDR_CF32_PLANAR "CF32_PLANAR"
+
 //! Real 64-bit floats (double)
 #define SOAPY_SDR_F64 "F64"
 
 //! Real 32-bit floats (float)
 #define SOAPY_SDR_F32 "F32"
 
+//! Real 16-bit floats (IEEE 754 half precision)
+#define SOAPY_SDR_F16 "F16"
+
 //! Real signed 32-bit integers (int32)
 #define SOAPY_SDR_S32 "S32"
 
@@ -72,6 +106,12 @@
 //! Real unsigned 8-bit integers (uint8)
 #define SOAPY_SDR_U8 "U8"
 
+//! Real 32-bit floats with big endian parts
+#define SOAPY_SDR_F32_BE "F32_BE"
+
+//! Real signed 16-bit integers with big endian parts
+#define SOAPY_SDR_S16_BE "S16_BE"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -163,6 +163,82 @@
  */
 #define SOAPY_SDR_API_HAS_PARALLEL_STRING_MAKE
 
+/*!
+ * Compatibility define for converter instruction set selection API
+ */
+#define SOAPY_SDR_API_HAS_CONVERTER_INSTRUCTION_SETS
+
+/*!
+ * Compatibility define for the resolved converter handle API
+ */
+#define SOAPY_SDR_API_HAS_CONVERTER_HANDLE
+
+/*!
+ * Compatibility define for the CF16 and F16 half precision formats
+ */
+#define SOAPY_SDR_API_HAS_HALF_PRECISION_FORMATS
+
+/*!
+ * Compatibility define for multi-channel batch conversion API
+ */
+#define SOAPY_SDR_API_HAS_CONVERTER_BATCH
+
+/*!
+ * Compatibility define for multi-hop converter path search
+ */
+#define SOAPY_SDR_API_HAS_CONVERTER_PATHS
+
+/*!
+ * Compatibility define for stateful converter functions
+ */
+#define SOAPY_SDR_API_HAS_STATEFUL_CONVERTERS
+
+/*!
+ * Compatibility define for the converter with DC offset and IQ balance correction
+ */
+#define SOAPY_SDR_API_HAS_IQ_CORRECTION_CONVERTER
+
+/*!
+ * Compatibility define for converting with complex scalers
+ */
+#define SOAPY_SDR_API_HAS_CONVERTER_COMPLEX_SCALER
+
+/*!
+ * Compatibility define for the converter with a frequency shifting mixer
+ */
+#define SOAPY_SDR_API_HAS_MIXER_CONVERTER
+
+/*!
+ * Compatibility define for the converter with decimation
+ */
+#define SOAPY_SDR_API_HAS_DECIMATING_CONVERTER
+
+/*!
+ * Compatibility define for the saturating converter with a clip count
+ */
+#define SOAPY_SDR_API_HAS_SATURATING_CONVERTER
+
+/*!
+ * Compatibility define for the dithered converters and DITHERED priority
+ */
+#define SOAPY_SDR_API_HAS_DITHERED_CONVERTERS
+
+/*!
+ * Compatibility define for parallel conversion on a worker pool
+ */
+#define SOAPY_SDR_API_HAS_CONVERTER_PARALLEL
+
+/*!
+ * Compatibility define for converter tuning with a per-host cache file
+ */
+#define SOAPY_SDR_API_HAS_CONVERTER_TUNING
+
+/*!
+ * Compatibility define for float to integer primitives that saturate
+ * beyond full scale and convert NaN to 0, see ConverterPrimitives.hpp
+ */
+#define SOAPY_SDR_API_HAS_SATURATING_PRIMITIVES
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -0,0 +1,39 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/***********************************************************************
+ * Buffer helpers for converters that split a buffer into chunks.
+ *
+ * A planar format is passed as an array of plane pointers rather than
+ * a pointer to the samples, so a chunk that starts at an element offset
+ * needs its own array of offset plane pointers. Each plane holds one
+ * part of an element, half of the element size.
+ **********************************************************************/
+inline bool isPlanarFormat(const std::string &format)
+{
+  return format.find("_PLANAR") != std::string::npos;
+}
+
+//a pointer to an element of a buffer; for planar formats, the planes array filled with offset plane pointers
+inline const void *offsetBuffer(const void *buff, const bool planar, const size_t elemSize, const size_t offset, const void *planes[2])
+{
+  if (not planar) return (const uint8_t *)buff + offset*elemSize;
+  const auto *from = (const uint8_t * const *)buff;
+  planes[0] = from[0] + offset*(elemSize/2);
+  planes[1] = from[1] + offset*(elemSize/2);
+  return planes;
+}
+
+inline void *offsetBuffer(void *buff, const bool planar, const size_t elemSize, const size_t offset, void *planes[2])
+{
+  if (not planar) return (uint8_t *)buff + offset*elemSize;
+  auto *from = (uint8_t * const *)buff;
+  planes[0] = from[0] + offset*(elemSize/2);
+  planes[1] = from[1] + offset*(elemSize/2);
+  return planes;
+}
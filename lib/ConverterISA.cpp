@@ -0,0 +1,87 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterISA.hpp"
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+
+static void cpuid(const unsigned leaf, const unsigned subleaf, unsigned regs[4])
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuidex(info, int(leaf), int(subleaf));
+    for (size_t i = 0; i < 4; i++) regs[i] = unsigned(info[i]);
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+//the xgetbv instruction reports which register states the OS saves
+static unsigned long long xgetbv0(void)
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned eax = 0, edx = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+
+#define BIT(n) (1u << (n))
+
+SoapySDR::ConverterRegistry::InstructionSet detectConverterInstructionSet(void)
+{
+    unsigned regs[4] = {0, 0, 0, 0};
+    cpuid(0, 0, regs);
+    const unsigned maxLeaf = regs[0];
+    if (maxLeaf < 1) return SoapySDR::ConverterRegistry::ISA_GENERIC;
+
+    cpuid(1, 0, regs);
+    const unsigned ecx1 = regs[2], edx1 = regs[3];
+    unsigned ebx7 = 0;
+    if (maxLeaf >= 7)
+    {
+        cpuid(7, 0, regs);
+        ebx7 = regs[1];
+    }
+
+    const bool sse2 = (edx1 & BIT(26)) != 0;
+    const bool sse41 = sse2 and (ecx1 & BIT(9)) != 0 and (ecx1 & BIT(19)) != 0;
+    const bool osxsave = (ecx1 & BIT(27)) != 0;
+    const unsigned long long xcr0 = osxsave?xgetbv0():0;
+    const bool osAVX = (xcr0 & 0x6) == 0x6; //XMM and YMM state
+    const bool osAVX512 = (xcr0 & 0xe6) == 0xe6; //and opmask, ZMM state
+    const bool avx2 = sse41 and osAVX and
+        (ecx1 & BIT(28)) != 0 and //AVX
+        (ecx1 & BIT(12)) != 0 and //FMA
+        (ecx1 & BIT(29)) != 0 and //F16C
+        (ebx7 & BIT(5)) != 0; //AVX2
+    const bool avx512 = avx2 and osAVX512 and
+        (ebx7 & BIT(16)) != 0 and //AVX512F
+        (ebx7 & BIT(30)) != 0 and //AVX512BW
+        (ebx7 & BIT(31)) != 0; //AVX512VL
+
+    if (avx512) return SoapySDR::ConverterRegistry::ISA_AVX512;
+    if (avx2) return SoapySDR::ConverterRegistry::ISA_AVX2;
+    if (sse41) return SoapySDR::ConverterRegistry::ISA_SSE41;
+    if (sse2) return SoapySDR::ConverterRegistry::ISA_SSE2;
+    return SoapySDR::ConverterRegistry::ISA_GENERIC;
+}
+
+#else
+
+SoapySDR::ConverterRegistry::InstructionSet detectConverterInstructionSet(void)
+{
+    return SoapySDR::ConverterRegistry::ISA_GENERIC;
+}
+
+#endif
@@ -0,0 +1,40 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/ConverterRegistry.hpp>
+
+/***********************************************************************
+ * Instruction set helpers for the vectorized converters.
+ *
+ * Kernels are compiled with per-function target attributes rather than
+ * per-file compiler flags. This keeps the registration code and any
+ * inline functions from the headers compiled for the baseline CPU,
+ * so the library loads on any host and the registry picks the kernel.
+ **********************************************************************/
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SOAPY_SDR_CONVERTER_X86
+#endif
+
+#if defined(SOAPY_SDR_CONVERTER_X86) && (defined(__GNUC__) || defined(__clang__))
+#define SOAPY_SDR_TARGET_SSE2 __attribute__((target("sse2")))
+#define SOAPY_SDR_TARGET_SSE41 __attribute__((target("sse2,ssse3,sse4.1")))
+#define SOAPY_SDR_TARGET_AVX2 __attribute__((target("avx2,fma,f16c")))
+#define SOAPY_SDR_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl,avx2,fma,f16c")))
+#elif defined(SOAPY_SDR_CONVERTER_X86) && defined(_MSC_VER)
+//MSVC does not require a target flag to use intrinsics
+#define SOAPY_SDR_TARGET_SSE2
+#define SOAPY_SDR_TARGET_SSE41
+#define SOAPY_SDR_TARGET_AVX2
+#define SOAPY_SDR_TARGET_AVX512
+#else
+//no x86 kernels on this architecture or compiler
+#undef SOAPY_SDR_CONVERTER_X86
+#endif
+
+/*!
+ * Detect the widest converter instruction set supported
+ * by the running CPU and operating system.
+ */
+SoapySDR::ConverterRegistry::InstructionSet detectConverterInstructionSet(void);
@@ -0,0 +1,226 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterBuffers.hpp"
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/***********************************************************************
+ * Worker pool
+ *
+ * A process-wide pool of threads, created on first use and kept for the
+ * life of the process. A job is a number of chunks; the caller and the
+ * workers claim chunks from a shared counter until none are left,
+ * so faster threads take more chunks and the load stays balanced.
+ * Concurrent callers share the pool: each job is listed while it runs,
+ * idle workers join the oldest job with chunks left, and every caller
+ * works on its own job, so no caller waits for another job to finish.
+ * A chunk that throws ends the job: no more chunks are claimed, and the
+ * first exception is thrown to the caller once the helpers are done.
+ **********************************************************************/
+struct ConverterJob
+{
+  std::function<void(const size_t)> task;
+  size_t numChunks;
+  size_t maxHelpers;
+  std::atomic<size_t> nextChunk;
+  size_t numHelpers; //guarded by the pool mutex
+  size_t activeHelpers; //guarded by the pool mutex
+  std::exception_ptr error; //guarded by the pool mutex
+
+  bool wantsHelper(void) const
+  {
+    return numHelpers < maxHelpers and nextChunk < numChunks;
+  }
+
+  void work(void)
+  {
+    for (size_t chunk = nextChunk++; chunk < numChunks; chunk = nextChunk++) task(chunk);
+  }
+
+  //leave the remaining chunks unclaimed
+  void stop(void)
+  {
+    nextChunk = numChunks;
+  }
+};
+
+class ConverterWorkerPool
+{
+public:
+  //the pool is never destroyed: joining threads during static destruction is not safe everywhere
+  static ConverterWorkerPool &instance(void)
+  {
+    static ConverterWorkerPool *pool = new ConverterWorkerPool();
+    return *pool;
+  }
+
+  size_t numWorkers(void) const
+  {
+    return _threads.size();
+  }
+
+  void run(ConverterJob &job)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _jobs.push_back(&job);
+    }
+    _workCond.notify_all();
+
+    {
+      //the job is unlisted even when a chunk throws on this thread
+      JobListing listing(*this, job);
+      job.work();
+    }
+
+    if (job.error) std::rethrow_exception(job.error);
+  }
+
+private:
+  //unlists a job, then waits for its helpers to finish their last chunks before it goes out of scope
+  struct JobListing
+  {
+    JobListing(ConverterWorkerPool &pool, ConverterJob &job):
+      pool(pool), job(job)
+    {
+      return;
+    }
+
+    ~JobListing(void)
+    {
+      job.stop();
+      std::unique_lock<std::mutex> lock(pool._mutex);
+      pool._jobs.erase(std::find(pool._jobs.begin(), pool._jobs.end(), &job));
+      pool._doneCond.wait(lock, [this]{return job.activeHelpers == 0;});
+    }
+
+    ConverterWorkerPool &pool;
+    ConverterJob &job;
+  };
+
+  ConverterWorkerPool(void)
+  {
+    const size_t numCores = std::max<size_t>(1, std::thread::hardware_concurrency());
+    for (size_t i = 0; i+1 < numCores; i++)
+      {
+        _threads.emplace_back(&ConverterWorkerPool::workerLoop, this);
+      }
+  }
+
+  //the oldest listed job that can take another helper, called with the mutex held
+  ConverterJob *nextJob(void) const
+  {
+    for (auto *job : _jobs)
+      {
+        if (job->wantsHelper()) return job;
+      }
+    return nullptr;
+  }
+
+  void workerLoop(void)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+      {
+        ConverterJob *job = nullptr;
+        _workCond.wait(lock, [&]{return (job = this->nextJob()) != nullptr;});
+        job->numHelpers++;
+        job->activeHelpers++;
+
+        lock.unlock();
+        std::exception_ptr error;
+        try
+          {
+            job->work();
+          }
+        catch (...)
+          {
+            job->stop();
+            error = std::current_exception();
+          }
+        lock.lock();
+
+        if (error and not job->error) job->error = error;
+        if (--job->activeHelpers == 0) _doneCond.notify_all();
+      }
+  }
+
+  std::mutex _mutex;
+  std::condition_variable _workCond;
+  std::condition_variable _doneCond;
+  std::vector<ConverterJob *> _jobs;
+  std::vector<std::thread> _threads;
+};
+
+/***********************************************************************
+ * Parallel conversion
+ **********************************************************************/
+static const size_t CACHE_LINE_SIZE = 64;
+
+//target bytes per chunk on the wider side, large enough to amortize claiming a chunk
+static const size_t PARALLEL_CHUNK_SIZE = 256*1024;
+
+static size_t gcd(size_t a, size_t b)
+{
+  while (b != 0)
+    {
+      const size_t t = a % b;
+      a = b;
+      b = t;
+    }
+  return a;
+}
+
+//the number of elements in one cache line, so slices start on a cache line in a buffer
+static size_t lineElems(const size_t elemSize)
+{
+  return CACHE_LINE_SIZE/gcd(CACHE_LINE_SIZE, elemSize);
+}
+
+void SoapySDR::Converter::convertParallel(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, const size_t numThreads) const
+{
+  auto &pool = ConverterWorkerPool::instance();
+  const size_t maxThreads = std::min(pool.numWorkers()+1, (numThreads == 0)?pool.numWorkers()+1:numThreads);
+
+  //chunks are a whole number of cache lines in both buffers
+  const size_t srcLine = lineElems(_sourceElemSize);
+  const size_t dstLine = lineElems(_targetElemSize);
+  const size_t align = srcLine/gcd(srcLine, dstLine)*dstLine;
+  const size_t elemSize = std::max<size_t>(1, std::max(_sourceElemSize, _targetElemSize));
+  const size_t chunkElems = std::max<size_t>(1, PARALLEL_CHUNK_SIZE/elemSize/align)*align;
+  const size_t numChunks = (numElems + chunkElems - 1)/chunkElems;
+
+  //stateful functions carry state from one sample to the next, so they stay serial
+  if (_stateful.convert != nullptr or maxThreads < 2 or numChunks < 2)
+    {
+      return this->convert(srcBuff, dstBuff, numElems, scaler);
+    }
+
+  const bool srcPlanar = isPlanarFormat(_sourceFormat);
+  const bool dstPlanar = isPlanarFormat(_targetFormat);
+  ConverterJob job;
+  job.task = [&](const size_t chunk)
+  {
+    const size_t offset = chunk*chunkElems;
+    const void *srcPlanes[2];
+    void *dstPlanes[2];
+    this->convert(
+      offsetBuffer(srcBuff, srcPlanar, _sourceElemSize, offset, srcPlanes),
+      offsetBuffer(dstBuff, dstPlanar, _targetElemSize, offset, dstPlanes),
+      std::min(chunkElems, numElems-offset), scaler);
+  };
+  job.numChunks = numChunks;
+  job.maxHelpers = std::min(maxThreads, numChunks)-1;
+  job.nextChunk = 0;
+  job.numHelpers = 0;
+  job.activeHelpers = 0;
+  pool.run(job);
+}
@@ -2,44 +2,232 @@
 // Copyright (c) 2018-2018 Josh Blum
 // SPDX-License-Identifier: BSL-1.0
 
+#include "ConverterISA.hpp"
+#include "ConverterBuffers.hpp"
 #include <SoapySDR/ConverterRegistry.hpp>
+#include <unordered_map>
 #include <algorithm>
 #include <stdexcept>
+#include <functional>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <cctype>
+#include <climits>
 
 void lateLoadDefaultConverters(void);
+std::string getEnvImpl(const char *name);
 
-static SoapySDR::ConverterRegistry::FormatConverters formatConverters;
+//registered functions for each instruction set of a source/target/priority
+typedef std::map<SoapySDR::ConverterRegistry::InstructionSet, SoapySDR::ConverterRegistry::ConverterFunction> InstructionSetFunctions;
+typedef std::map<SoapySDR::ConverterRegistry::FunctionPriority, InstructionSetFunctions> PriorityFunctions;
 
-SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction)
+//registered functions hashed on the source/target format pair
+typedef std::pair<std::string, std::string> FormatPair;
+
+struct FormatPairHash
+{
+  size_t operator()(const FormatPair &formats) const
+  {
+    const size_t h = std::hash<std::string>()(formats.first);
+    return h ^ (std::hash<std::string>()(formats.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+  }
+};
+
+typedef std::unordered_map<FormatPair, PriorityFunctions, FormatPairHash> FormatConverterTable;
+
+//registered stateful functions for each priority of a source/target
+typedef std::map<SoapySDR::ConverterRegistry::FunctionPriority, SoapySDR::ConverterRegistry::StatefulFunctions> StatefulPriorityFunctions;
+typedef std::unordered_map<FormatPair, StatefulPriorityFunctions, FormatPairHash> StatefulConverterTable;
+
+/***********************************************************************
+ * Registry storage
+ *
+ * Registrations are added to a pending table under the registry mutex.
+ * Lookups read an immutable snapshot of the table through an atomic
+ * pointer, without locking. A lookup that notices new registrations
+ * (the generation changed) publishes a fresh snapshot under the mutex,
+ * so a module that registers many converters causes a single copy.
+ * Replaced snapshots are retained for the life of the process
+ * because other threads may still be reading them.
+ **********************************************************************/
+struct FormatConverterSnapshot
+{
+  FormatConverterTable table;
+  StatefulConverterTable statefulTable;
+  size_t generation;
+
+  //multi-hop paths found in this table, filled in on demand
+  mutable std::mutex pathMutex;
+  mutable std::unordered_map<FormatPair, std::vector<std::string>, FormatPairHash> paths;
+};
+
+static std::mutex registryMutex;
+static std::atomic<size_t> registryGeneration(0);
+static std::atomic<const FormatConverterSnapshot *> currentSnapshot(nullptr);
+
+static FormatConverterTable &getPendingTable(void)
+{
+  static FormatConverterTable table;
+  return table;
+}
+
+static StatefulConverterTable &getPendingStatefulTable(void)
+{
+  static StatefulConverterTable table;
+  return table;
+}
+
+static std::vector<std::unique_ptr<const FormatConverterSnapshot>> &getPublishedSnapshots(void)
+{
+  static std::vector<std::unique_ptr<const FormatConverterSnapshot>> snapshots;
+  return snapshots;
+}
+
+static const FormatConverterSnapshot &publishSnapshot(void)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+
+  //another thread may have published while we waited on the lock
+  const auto generation = registryGeneration.load(std::memory_order_relaxed);
+  const auto *snapshot = currentSnapshot.load(std::memory_order_relaxed);
+  if (snapshot != nullptr and snapshot->generation == generation) return *snapshot;
+
+  std::unique_ptr<FormatConverterSnapshot> next(new FormatConverterSnapshot());
+  next->table = getPendingTable();
+  next->statefulTable = getPendingStatefulTable();
+  next->generation = generation;
+  snapshot = next.get();
+  getPublishedSnapshots().emplace_back(std::move(next));
+  currentSnapshot.store(snapshot, std::memory_order_release);
+  return *snapshot;
+}
+
+static const FormatConverterSnapshot &getSnapshot(void)
+{
+  //one guard check rather than the guards of every default registration
+  static const bool defaultsLoaded = (lateLoadDefaultConverters(), true);
+  (void)defaultsLoaded;
+
+  const auto *snapshot = currentSnapshot.load(std::memory_order_acquire);
+  if (snapshot != nullptr and snapshot->generation == registryGeneration.load(std::memory_order_acquire)) return *snapshot;
+  return publishSnapshot();
+}
+
+static const PriorityFunctions *findConverters(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto &table = getSnapshot().table;
+  const auto it = table.find(FormatPair(sourceFormat, targetFormat));
+  if (it == table.end()) return nullptr;
+  return &it->second;
+}
+
+static const StatefulPriorityFunctions *findStatefulConverters(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto &table = getSnapshot().statefulTable;
+  const auto it = table.find(FormatPair(sourceFormat, targetFormat));
+  if (it == table.end()) return nullptr;
+  return &it->second;
+}
+
+static SoapySDR::ConverterRegistry::InstructionSet loadInstructionSet(void)
+{
+  const auto detected = detectConverterInstructionSet();
+  std::string value = getEnvImpl("SOAPY_SDR_CONVERTER_ISA");
+  if (value.empty()) return detected;
+
+  std::transform(value.begin(), value.end(), value.begin(), [](const char ch){return char(std::tolower(ch));});
+  SoapySDR::ConverterRegistry::InstructionSet requested;
+  if (value == "generic") requested = SoapySDR::ConverterRegistry::ISA_GENERIC;
+  else if (value == "sse2") requested = SoapySDR::ConverterRegistry::ISA_SSE2;
+  else if (value == "sse4.1" or value == "sse41") requested = SoapySDR::ConverterRegistry::ISA_SSE41;
+  else if (value == "avx2") requested = SoapySDR::ConverterRegistry::ISA_AVX2;
+  else if (value == "avx512") requested = SoapySDR::ConverterRegistry::ISA_AVX512;
+  else
+    {
+      SoapySDR::logf(SOAPY_SDR_WARNING, "SOAPY_SDR_CONVERTER_ISA=%s unknown instruction set, ignored", value.c_str());
+      return detected;
+    }
+
+  if (requested > detected)
+    {
+      SoapySDR::logf(SOAPY_SDR_WARNING, "SOAPY_SDR_CONVERTER_ISA=%s not supported by this CPU, ignored", value.c_str());
+      return detected;
+    }
+  return requested;
+}
+
+//select the function with the widest instruction set usable on this host
+static SoapySDR::ConverterRegistry::ConverterFunction selectFunction(const InstructionSetFunctions &functions)
 {
-  if (formatConverters.count(sourceFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat].count(targetFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat][targetFormat].count(priority) != 0)
+  const auto isa = SoapySDR::ConverterRegistry::getInstructionSet();
+  for (auto it = functions.rbegin(); it != functions.rend(); ++it)
     {
-      SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ConverterRegistry(%s, %s, %s) duplicate registration", sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str());
+      if (it->first <= isa) return it->second;
+    }
+  return nullptr;
+}
+
+//get the priorities with at least one function usable on this host
+static std::vector<SoapySDR::ConverterRegistry::FunctionPriority> usablePriorities(const PriorityFunctions &priorities)
+{
+  std::vector<SoapySDR::ConverterRegistry::FunctionPriority> result;
+  for (const auto &it : priorities)
+    {
+      if (selectFunction(it.second) != nullptr) result.push_back(it.first);
+    }
+  return result;
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction):
+  ConverterRegistry(sourceFormat, targetFormat, priority, converterFunction, ISA_GENERIC)
+{
+  return;
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction, const InstructionSet isa)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+
+  auto &functions = getPendingTable()[FormatPair(sourceFormat, targetFormat)][priority];
+  if (functions.count(isa) != 0)
+    {
+      SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ConverterRegistry(%s, %s, %s, %s) duplicate registration", sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str(), std::to_string(isa).c_str());
       return;
     }
-  
-  formatConverters[sourceFormat][targetFormat][priority] = converterFunction;
+
+  functions[isa] = converterFunction;
+  registryGeneration.fetch_add(1, std::memory_order_release);
 
   return;
 }
 
-std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const std::string &sourceFormat)
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const StatefulFunctions &functions)
 {
-  lateLoadDefaultConverters();
+  std::lock_guard<std::mutex> lock(registryMutex);
 
-  std::vector<std::string> targets;
+  auto &priorities = getPendingStatefulTable()[FormatPair(sourceFormat, targetFormat)];
+  if (priorities.count(priority) != 0)
+    {
+      SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ConverterRegistry(%s, %s, %s) duplicate stateful registration", sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str());
+      return;
+    }
 
-  if (formatConverters.count(sourceFormat) == 0)
-    return targets;
+  priorities[priority] = functions;
+  registryGeneration.fetch_add(1, std::memory_order_release);
+
+  return;
+}
+
+std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const std::string &sourceFormat)
+{
+  std::vector<std::string> targets;
 
-  for(const auto &it:formatConverters[sourceFormat])
+  for(const auto &it:getSnapshot().table)
     {
-      std::string targetFormat = it.first;
-      targets.push_back(targetFormat);
+      if (it.first.first != sourceFormat) continue;
+      if (usablePriorities(it.second).empty()) continue;
+      targets.push_back(it.first.second);
     }
   
   std::sort(targets.begin(), targets.end());
@@ -48,15 +236,13 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const st
 
 std::vector<std::string> SoapySDR::ConverterRegistry::listSourceFormats(const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
-
   std::vector<std::string> sources;
 
-  for(const auto &it:formatConverters)
+  for(const auto &it:getSnapshot().table)
     {
-      std::string sourceFormat = it.first;
-      if (formatConverters[sourceFormat].count(targetFormat) > 0)
-        sources.push_back(sourceFormat);
+      if (it.first.second != targetFormat) continue;
+      if (usablePriorities(it.second).empty()) continue;
+      sources.push_back(it.first.first);
     }
   
   std::sort(sources.begin(), sources.end());
@@ -65,91 +251,449 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listSourceFormats(const st
 
 std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listPriorities(const std::string &sourceFormat, const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  const auto converters = findConverters(sourceFormat, targetFormat);
+  if (converters == nullptr)
+    return std::vector<FunctionPriority>();
 
-  std::vector<FunctionPriority> priorities;
-  
-  if (formatConverters.count(sourceFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat].count(targetFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat][targetFormat].size() == 0)
-    ;
-  else
+  return usablePriorities(*converters);
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto converters = findConverters(sourceFormat, targetFormat);
+  if (converters == nullptr)
+    {
+      throw std::runtime_error("ConverterRegistry::getFunction() conversion not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+
+  for (auto it = converters->rbegin(); it != converters->rend(); ++it)
     {
-      for(const auto &it:formatConverters[sourceFormat][targetFormat])
+      const auto function = selectFunction(it->second);
+      if (function != nullptr) return function;
+    }
+
+  throw std::runtime_error("ConverterRegistry::getFunction() no functions found for registered conversion; "
+                           "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  const auto converters = findConverters(sourceFormat, targetFormat);
+  if (converters == nullptr)
+    {
+      throw std::runtime_error("ConverterRegistry::getFunction() conversion not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
+    }
+
+  const auto priorityIt = converters->find(priority);
+  const auto function = (priorityIt == converters->end())?nullptr:selectFunction(priorityIt->second);
+  if (function == nullptr)
+    {
+      throw std::runtime_error("ConverterRegistry::getFunction() conversion priority not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
+    }
+
+  return function;
+}
+
+std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats(void)
+{
+    std::vector<std::string> sources;
+    for (const auto &it : getSnapshot().table)
+    {
+        if (usablePriorities(it.second).empty()) continue;
+        if (std::find(sources.begin(), sources.end(), it.first.first) == sources.end())
         {
-          FunctionPriority priority = it.first;
-          priorities.push_back(priority);
+            sources.push_back(it.first.first);
         }
     }
-  
+    std::sort(sources.begin(), sources.end());
+    return sources;
+}
+
+SoapySDR::ConverterRegistry::InstructionSet SoapySDR::ConverterRegistry::getInstructionSet(void)
+{
+  static const InstructionSet isa = loadInstructionSet();
+  return isa;
+}
+
+std::vector<SoapySDR::ConverterRegistry::InstructionSet> SoapySDR::ConverterRegistry::listInstructionSets(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  std::vector<InstructionSet> instructionSets;
+
+  const auto converters = findConverters(sourceFormat, targetFormat);
+  if (converters == nullptr)
+    return instructionSets;
+
+  const auto priorityIt = converters->find(priority);
+  if (priorityIt == converters->end())
+    return instructionSets;
+
+  for (const auto &it : priorityIt->second)
+    {
+      if (it.first <= getInstructionSet()) instructionSets.push_back(it.first);
+    }
+
+  return instructionSets;
+}
+
+SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, const InstructionSet &isa)
+{
+  const auto converters = findConverters(sourceFormat, targetFormat);
+  const auto priorityIt = (converters == nullptr)?PriorityFunctions::const_iterator():converters->find(priority);
+  const auto isaIt = (converters == nullptr or priorityIt == converters->end())?InstructionSetFunctions::const_iterator():priorityIt->second.find(isa);
+  if (converters == nullptr or priorityIt == converters->end() or isaIt == priorityIt->second.end() or isa > getInstructionSet())
+    {
+      throw std::runtime_error("ConverterRegistry::getFunction() conversion instruction set not available; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority)+", isa="+std::to_string(isa));
+    }
+
+  return isaIt->second;
+}
+
+std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listStatefulPriorities(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  std::vector<FunctionPriority> priorities;
+
+  const auto converters = findStatefulConverters(sourceFormat, targetFormat);
+  if (converters == nullptr)
+    return priorities;
+
+  for (const auto &it : *converters) priorities.push_back(it.first);
   return priorities;
-  
 }
 
-SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat)
+SoapySDR::ConverterRegistry::StatefulFunctions SoapySDR::ConverterRegistry::getStatefulFunctions(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  const auto converters = findStatefulConverters(sourceFormat, targetFormat);
+  const auto priorityIt = (converters == nullptr)?StatefulPriorityFunctions::const_iterator():converters->find(priority);
+  if (converters == nullptr or priorityIt == converters->end())
+    {
+      throw std::runtime_error("ConverterRegistry::getStatefulFunctions() conversion priority not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
+    }
+
+  return priorityIt->second;
+}
+
+/***********************************************************************
+ * Multi-hop path search
+ *
+ * A breadth-first search over the usable conversions finds the paths
+ * with the fewest hops, and among those, the path whose narrowest
+ * intermediate format is the widest, to avoid losing precision.
+ * Planar formats hold plane pointers rather than samples,
+ * so they are only converted directly, never along a path.
+ * Formats without a known element size are never intermediate formats.
+ **********************************************************************/
+static const size_t MAX_PATH_HOPS = 3;
+
+static std::vector<std::string> searchPath(const FormatConverterTable &table, const std::string &sourceFormat, const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  const auto direct = table.find(FormatPair(sourceFormat, targetFormat));
+  if (direct != table.end() and not usablePriorities(direct->second).empty())
+    {
+      return {sourceFormat, targetFormat};
+    }
+  if (isPlanarFormat(sourceFormat) or isPlanarFormat(targetFormat)) return {};
 
-  if (formatConverters.count(sourceFormat) == 0)
+  std::map<std::string, std::vector<std::string>> edges;
+  for (const auto &it : table)
     {
-      throw std::runtime_error("ConverterRegistry::getFunction() conversion source not registered; "
-                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+      if (it.first.first == it.first.second) continue;
+      if (usablePriorities(it.second).empty()) continue;
+      edges[it.first.first].push_back(it.first.second);
     }
-  
-  if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  for (auto &it : edges) std::sort(it.second.begin(), it.second.end());
+
+  //format -> previous format on the best path
+  std::map<std::string, std::string> previous;
+  previous[sourceFormat] = "";
+
+  //formats reached by the last hop -> narrowest intermediate element size
+  std::map<std::string, size_t> frontier;
+  frontier[sourceFormat] = SIZE_MAX;
+
+  for (size_t hop = 0; hop < MAX_PATH_HOPS and not frontier.empty(); hop++)
     {
-      throw std::runtime_error("ConverterRegistry::getFunction() conversion target not registered; "
-                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+      std::map<std::string, size_t> next;
+      std::map<std::string, std::string> nextPrevious;
+      for (const auto &from : frontier)
+        {
+          const auto it = edges.find(from.first);
+          if (it == edges.end()) continue;
+          for (const auto &to : it->second)
+            {
+              if (previous.count(to) != 0) continue; //reached with fewer hops
+              if (to != targetFormat and (isPlanarFormat(to) or SoapySDR::formatToSize(to) == 0)) continue;
+              const size_t width = (to == targetFormat)?from.second:std::min(from.second, SoapySDR::formatToSize(to));
+              const auto nextIt = next.find(to);
+              if (nextIt != next.end() and nextIt->second >= width) continue;
+              next[to] = width;
+              nextPrevious[to] = from.first;
+            }
+        }
+      previous.insert(nextPrevious.begin(), nextPrevious.end());
+
+      if (next.count(targetFormat) != 0)
+        {
+          std::vector<std::string> path;
+          for (std::string format = targetFormat; not format.empty(); format = previous[format])
+            {
+              path.insert(path.begin(), format);
+            }
+          return path;
+        }
+      frontier = next;
     }
 
-  if (formatConverters[sourceFormat][targetFormat].size() == 0)
+  return {};
+}
+
+std::vector<std::string> SoapySDR::ConverterRegistry::findPath(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto &snapshot = getSnapshot();
+  std::lock_guard<std::mutex> lock(snapshot.pathMutex);
+
+  const FormatPair formats(sourceFormat, targetFormat);
+  const auto it = snapshot.paths.find(formats);
+  if (it != snapshot.paths.end()) return it->second;
+
+  const auto path = searchPath(snapshot.table, sourceFormat, targetFormat);
+  snapshot.paths[formats] = path;
+  return path;
+}
+
+/***********************************************************************
+ * Converter handle
+ **********************************************************************/
+static SoapySDR::ConverterRegistry::FunctionPriority highestPriority(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto priorities = SoapySDR::ConverterRegistry::listPriorities(sourceFormat, targetFormat);
+  if (priorities.empty())
     {
-      throw std::runtime_error("ConverterRegistry::getFunction() no functions found for registered conversion; "
+      throw std::runtime_error("Converter() no functions found for conversion; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
+  return priorities.back();
+}
 
-  return formatConverters[sourceFormat][targetFormat].rbegin()->second;
+static size_t formatToDepth(const std::string &format)
+{
+  return (not format.empty() and format.front() == 'C')?2:1;
 }
 
-SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+static bool isFloatFormat(const std::string &format)
 {
-  lateLoadDefaultConverters();
+  const size_t i = (not format.empty() and format.front() == 'C')?1:0;
+  return format.size() > i and format[i] == 'F';
+}
 
-  if (formatConverters.count(sourceFormat) == 0)
+//bytes per staging buffer for a path of conversions, sized for the L1 cache
+static const size_t PATH_STAGING_SIZE = 16*1024;
+
+SoapySDR::Converter::Converter(void):
+  _priority(ConverterRegistry::GENERIC),
+  _function(nullptr),
+  _sourceElemSize(0),
+  _targetElemSize(0),
+  _sourceElemDepth(0),
+  _targetElemDepth(0),
+  _stateful(),
+  _context(nullptr),
+  _scalerHop(0),
+  _chunkElems(0)
+{
+  return;
+}
+
+SoapySDR::Converter::Converter(const std::string &sourceFormat, const std::string &targetFormat, const Kwargs &args):
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _priority(ConverterRegistry::CUSTOM),
+  _function(nullptr),
+  _sourceElemSize(SoapySDR::formatToSize(sourceFormat)),
+  _targetElemSize(SoapySDR::formatToSize(targetFormat)),
+  _sourceElemDepth(formatToDepth(sourceFormat)),
+  _targetElemDepth(formatToDepth(targetFormat)),
+  _args(args),
+  _stateful(),
+  _context(nullptr),
+  _scalerHop(0),
+  _chunkElems(0)
+{
+  const auto priorities = ConverterRegistry::listPriorities(sourceFormat, targetFormat);
+  const auto statefulPriorities = ConverterRegistry::listStatefulPriorities(sourceFormat, targetFormat);
+  if (not statefulPriorities.empty() and (priorities.empty() or statefulPriorities.back() > priorities.back()))
     {
-      throw std::runtime_error("ConverterRegistry::getFunction() conversion source not registered; "
-                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
+      _path = {sourceFormat, targetFormat};
+      this->resolveStateful(statefulPriorities.back());
+      return;
     }
 
-  if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  _path = ConverterRegistry::findPath(sourceFormat, targetFormat);
+  if (_path.empty())
     {
-      throw std::runtime_error("ConverterRegistry::getFunction() conversion target not registered; "
-                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
+      throw std::runtime_error("Converter() no functions found for conversion; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
 
-  if (formatConverters[sourceFormat][targetFormat].count(priority) == 0)
+  if (_path.size() == 2)
     {
-      throw std::runtime_error("ConverterRegistry::getFunction() conversion priority not registered; "
-                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
+      _priority = highestPriority(sourceFormat, targetFormat);
+      _function = ConverterRegistry::getFunction(sourceFormat, targetFormat, _priority);
+      return;
+    }
+
+  size_t stagingElemSize = 0;
+  for (size_t hop = 0; hop+1 < _path.size(); hop++)
+    {
+      const auto priority = highestPriority(_path[hop], _path[hop+1]);
+      _priority = std::min(_priority, priority);
+      _hopFunctions.push_back(ConverterRegistry::getFunction(_path[hop], _path[hop+1], priority));
+      if (hop != 0) stagingElemSize = std::max(stagingElemSize, SoapySDR::formatToSize(_path[hop]));
     }
+  _chunkElems = PATH_STAGING_SIZE/stagingElemSize;
 
-  return formatConverters[sourceFormat][targetFormat][priority];
+  //apply the scaler once, on the first hop to or from a float format
+  for (size_t hop = 0; hop < _hopFunctions.size(); hop++)
+    {
+      if (not isFloatFormat(_path[hop]) and not isFloatFormat(_path[hop+1])) continue;
+      _scalerHop = hop;
+      break;
+    }
 }
 
-std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats(void)
+SoapySDR::Converter::Converter(const std::string &sourceFormat, const std::string &targetFormat, const ConverterRegistry::FunctionPriority &priority, const Kwargs &args):
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _priority(priority),
+  _function(nullptr),
+  _sourceElemSize(SoapySDR::formatToSize(sourceFormat)),
+  _targetElemSize(SoapySDR::formatToSize(targetFormat)),
+  _sourceElemDepth(formatToDepth(sourceFormat)),
+  _targetElemDepth(formatToDepth(targetFormat)),
+  _args(args),
+  _stateful(),
+  _context(nullptr),
+  _path({sourceFormat, targetFormat}),
+  _scalerHop(0),
+  _chunkElems(0)
+{
+  const auto priorities = ConverterRegistry::listPriorities(sourceFormat, targetFormat);
+  const auto statefulPriorities = ConverterRegistry::listStatefulPriorities(sourceFormat, targetFormat);
+  if (std::find(priorities.begin(), priorities.end(), priority) == priorities.end() and
+      std::find(statefulPriorities.begin(), statefulPriorities.end(), priority) != statefulPriorities.end())
+    {
+      this->resolveStateful(priority);
+    }
+  else _function = ConverterRegistry::getFunction(sourceFormat, targetFormat, priority);
+}
+
+SoapySDR::Converter::Converter(const Converter &other):
+  _sourceFormat(other._sourceFormat),
+  _targetFormat(other._targetFormat),
+  _priority(other._priority),
+  _function(other._function),
+  _sourceElemSize(other._sourceElemSize),
+  _targetElemSize(other._targetElemSize),
+  _sourceElemDepth(other._sourceElemDepth),
+  _targetElemDepth(other._targetElemDepth),
+  _args(other._args),
+  _stateful(other._stateful),
+  _context(nullptr),
+  _path(other._path),
+  _hopFunctions(other._hopFunctions),
+  _scalerHop(other._scalerHop),
+  _chunkElems(other._chunkElems)
 {
-    lateLoadDefaultConverters();
+  if (_stateful.create != nullptr) _context = _stateful.create(_args);
+}
 
-    std::vector<std::string> sources;
-    for (const auto &it : formatConverters)
+SoapySDR::Converter::Converter(Converter &&other):
+  Converter()
+{
+  *this = std::move(other);
+}
+
+SoapySDR::Converter::~Converter(void)
+{
+  if (_stateful.destroy != nullptr) _stateful.destroy(_context);
+}
+
+SoapySDR::Converter &SoapySDR::Converter::operator=(const Converter &other)
+{
+  if (this != &other) *this = Converter(other);
+  return *this;
+}
+
+SoapySDR::Converter &SoapySDR::Converter::operator=(Converter &&other)
+{
+  if (this == &other) return *this;
+  if (_stateful.destroy != nullptr) _stateful.destroy(_context);
+
+  _sourceFormat = std::move(other._sourceFormat);
+  _targetFormat = std::move(other._targetFormat);
+  _priority = other._priority;
+  _function = other._function;
+  _sourceElemSize = other._sourceElemSize;
+  _targetElemSize = other._targetElemSize;
+  _sourceElemDepth = other._sourceElemDepth;
+  _targetElemDepth = other._targetElemDepth;
+  _args = std::move(other._args);
+  _stateful = other._stateful;
+  _context = other._context;
+  _path = std::move(other._path);
+  _hopFunctions = std::move(other._hopFunctions);
+  _scalerHop = other._scalerHop;
+  _chunkElems = other._chunkElems;
+
+  //the context now belongs to this converter
+  other._stateful = ConverterRegistry::StatefulFunctions();
+  other._context = nullptr;
+  return *this;
+}
+
+void SoapySDR::Converter::resolveStateful(const ConverterRegistry::FunctionPriority &priority)
+{
+  _stateful = ConverterRegistry::getStatefulFunctions(_sourceFormat, _targetFormat, priority);
+  _priority = priority;
+  _context = _stateful.create(_args);
+}
+
+void SoapySDR::Converter::convertPath(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler) const
+{
+  //each hop reads the staging buffer written by the previous hop
+  alignas(64) uint8_t staging[2][PATH_STAGING_SIZE];
+
+  const auto *src = (const uint8_t *)srcBuff;
+  auto *dst = (uint8_t *)dstBuff;
+  const size_t numHops = _hopFunctions.size();
+  for (size_t offset = 0; offset < numElems; offset += _chunkElems)
     {
-        if (std::find(sources.begin(), sources.end(), it.first) == sources.end())
+      const size_t n = std::min(_chunkElems, numElems-offset);
+      const void *in = src + offset*_sourceElemSize;
+      for (size_t hop = 0; hop < numHops; hop++)
         {
-            sources.push_back(it.first);
+          void *out = (hop+1 == numHops)?(dst + offset*_targetElemSize):staging[hop%2];
+          _hopFunctions[hop](in, out, n, (hop == _scalerHop)?scaler:1.0);
+          in = out;
         }
     }
-    std::sort(sources.begin(), sources.end());
-    return sources;
+}
+
+void SoapySDR::Converter::convertBatch(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double *scalers) const
+{
+  //one context would carry the state of one channel into the next
+  if (this->isStateful())
+    {
+      throw std::runtime_error("Converter::convertBatch() not supported for stateful functions, use one Converter per channel; "
+                               "sourceFormat="+_sourceFormat+", targetFormat="+_targetFormat);
+    }
+
+  for (size_t ch = 0; ch < numChans; ch++)
+    {
+      this->convert(srcBuffs[ch], dstBuffs[ch], numElems, (scalers == nullptr)?1.0:scalers[ch]);
+    }
 }
@@ -0,0 +1,890 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterISA.hpp"
+#include "ConverterBuffers.hpp"
+#include <SoapySDR/ConverterStages.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+#include <cstring>
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+#include <emmintrin.h>
+#endif
+
+//elements per chunk, the CF32 output of a chunk stays in the L1 cache
+static const size_t STAGE_CHUNK_ELEMS = 2048;
+
+/***********************************************************************
+ * IQ correction kernels
+ *
+ * Correct a CF32 chunk in place: y = M*(x - dc) where M is the 2x2 matrix
+ * [[a, b], [b, d]] of the IQ balance correction. Accumulate the sums
+ * for the automatic estimates: the input mean and the output second moments.
+ **********************************************************************/
+struct IQCorrectionSums
+{
+  double sumI, sumQ; //input sums
+  double powII, powQQ, powIQ; //output second moments
+};
+
+typedef void (*IQCorrectionKernel)(float *buff, const size_t numElems, const float *dc, const float a, const float b, const float d, IQCorrectionSums &sums);
+
+static void genericIQCorrection(float *buff, const size_t numElems, const float *dc, const float a, const float b, const float d, IQCorrectionSums &sums)
+{
+  float sumI = 0, sumQ = 0, powII = 0, powQQ = 0, powIQ = 0;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const float xI = buff[i*2+0];
+      const float xQ = buff[i*2+1];
+      sumI += xI;
+      sumQ += xQ;
+      const float yI = a*(xI - dc[0]) + b*(xQ - dc[1]);
+      const float yQ = b*(xI - dc[0]) + d*(xQ - dc[1]);
+      powII += yI*yI;
+      powQQ += yQ*yQ;
+      powIQ += yI*yQ;
+      buff[i*2+0] = yI;
+      buff[i*2+1] = yQ;
+    }
+  sums = {sumI, sumQ, powII, powQQ, powIQ};
+}
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+static SOAPY_SDR_TARGET_SSE2 void sse2IQCorrection(float *buff, const size_t numElems, const float *dc, const float a, const float b, const float d, IQCorrectionSums &sums)
+{
+  //2 complex elements per vector: [I0, Q0, I1, Q1]
+  const __m128 vDC = _mm_setr_ps(dc[0], dc[1], dc[0], dc[1]);
+  const __m128 vDiag = _mm_setr_ps(a, d, a, d);
+  const __m128 vCross = _mm_set1_ps(b);
+  __m128 vSum = _mm_setzero_ps();
+  __m128 vPow = _mm_setzero_ps();
+  __m128 vCrossPow = _mm_setzero_ps();
+
+  size_t i = 0;
+  for (; i+2 <= numElems; i += 2)
+    {
+      const __m128 x = _mm_loadu_ps(buff+i*2);
+      vSum = _mm_add_ps(vSum, x);
+      const __m128 c = _mm_sub_ps(x, vDC);
+      const __m128 swapped = _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 3, 0, 1));
+      const __m128 y = _mm_add_ps(_mm_mul_ps(c, vDiag), _mm_mul_ps(swapped, vCross));
+      vPow = _mm_add_ps(vPow, _mm_mul_ps(y, y));
+      vCrossPow = _mm_add_ps(vCrossPow, _mm_mul_ps(y, _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1))));
+      _mm_storeu_ps(buff+i*2, y);
+    }
+
+  float sum[4], pow[4], crossPow[4];
+  _mm_storeu_ps(sum, vSum);
+  _mm_storeu_ps(pow, vPow);
+  _mm_storeu_ps(crossPow, vCrossPow);
+
+  IQCorrectionSums tail;
+  genericIQCorrection(buff+i*2, numElems-i, dc, a, b, d, tail);
+
+  //each cross product lane holds yI*yQ, so the 4 lanes count each element twice
+  sums.sumI = double(sum[0]) + sum[2] + tail.sumI;
+  sums.sumQ = double(sum[1]) + sum[3] + tail.sumQ;
+  sums.powII = double(pow[0]) + pow[2] + tail.powII;
+  sums.powQQ = double(pow[1]) + pow[3] + tail.powQQ;
+  sums.powIQ = (double(crossPow[0]) + crossPow[1] + crossPow[2] + crossPow[3])/2 + tail.powIQ;
+}
+#endif //SOAPY_SDR_CONVERTER_X86
+
+static IQCorrectionKernel selectIQCorrection(void)
+{
+  #ifdef SOAPY_SDR_CONVERTER_X86
+  if (SoapySDR::ConverterRegistry::getInstructionSet() >= SoapySDR::ConverterRegistry::ISA_SSE2) return &sse2IQCorrection;
+  #endif
+  return &genericIQCorrection;
+}
+
+/***********************************************************************
+ * Complex scaler kernels
+ *
+ * Multiply CF32 by a complex scaler: I' = sr*I - si*Q, Q' = si*I + sr*Q.
+ * The source and destination may be the same buffer.
+ **********************************************************************/
+typedef void (*ComplexScalerKernel)(const float *src, float *dst, const size_t numElems, const float sr, const float si);
+
+static void genericComplexScaler(const float *src, float *dst, const size_t numElems, const float sr, const float si)
+{
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const float I = src[i*2+0];
+      const float Q = src[i*2+1];
+      dst[i*2+0] = sr*I - si*Q;
+      dst[i*2+1] = si*I + sr*Q;
+    }
+}
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+static SOAPY_SDR_TARGET_SSE2 void sse2ComplexScaler(const float *src, float *dst, const size_t numElems, const float sr, const float si)
+{
+  //2 complex elements per vector: [I0, Q0, I1, Q1]
+  const __m128 vReal = _mm_set1_ps(sr);
+  const __m128 vImag = _mm_setr_ps(-si, si, -si, si);
+
+  size_t i = 0;
+  for (; i+2 <= numElems; i += 2)
+    {
+      const __m128 x = _mm_loadu_ps(src+i*2);
+      const __m128 swapped = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+      _mm_storeu_ps(dst+i*2, _mm_add_ps(_mm_mul_ps(x, vReal), _mm_mul_ps(swapped, vImag)));
+    }
+
+  genericComplexScaler(src+i*2, dst+i*2, numElems-i, sr, si);
+}
+#endif //SOAPY_SDR_CONVERTER_X86
+
+static ComplexScalerKernel selectComplexScaler(void)
+{
+  #ifdef SOAPY_SDR_CONVERTER_X86
+  if (SoapySDR::ConverterRegistry::getInstructionSet() >= SoapySDR::ConverterRegistry::ISA_SSE2) return &sse2ComplexScaler;
+  #endif
+  return &genericComplexScaler;
+}
+
+/***********************************************************************
+ * Mixer kernels
+ *
+ * Multiply CF32 by exp(j*(phase + i*step)) for each element i.
+ * The oscillator is a phasor rotated by the step each sample;
+ * it is computed exactly in double precision every MIXER_SEED_ELEMS
+ * elements, so the float rounding of the rotation does not accumulate.
+ * The source and destination may be the same buffer.
+ **********************************************************************/
+static const size_t MIXER_SEED_ELEMS = 64;
+static const double MIXER_TWO_PI = 6.283185307179586476925;
+
+typedef void (*MixerKernel)(const float *src, float *dst, const size_t numElems, const double phase, const double step);
+
+static void genericMixer(const float *src, float *dst, const size_t numElems, const double phase, const double step)
+{
+  const float rotReal = float(std::cos(step));
+  const float rotImag = float(std::sin(step));
+
+  for (size_t i = 0; i < numElems; i += MIXER_SEED_ELEMS)
+    {
+      const size_t last = std::min(i+MIXER_SEED_ELEMS, numElems);
+      float pReal = float(std::cos(phase + i*step));
+      float pImag = float(std::sin(phase + i*step));
+      for (size_t k = i; k < last; k++)
+        {
+          const float I = src[k*2+0];
+          const float Q = src[k*2+1];
+          dst[k*2+0] = I*pReal - Q*pImag;
+          dst[k*2+1] = I*pImag + Q*pReal;
+          const float nextReal = pReal*rotReal - pImag*rotImag;
+          pImag = pReal*rotImag + pImag*rotReal;
+          pReal = nextReal;
+        }
+    }
+}
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+static SOAPY_SDR_TARGET_SSE2 void sse2Mixer(const float *src, float *dst, const size_t numElems, const double phase, const double step)
+{
+  //2 complex elements per vector: [I0, Q0, I1, Q1], the phasors advance by 2 steps
+  const __m128 vSign = _mm_setr_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+  const __m128 vRotReal = _mm_set1_ps(float(std::cos(2*step)));
+  const __m128 vRotImag = _mm_mul_ps(_mm_set1_ps(float(std::sin(2*step))), vSign);
+
+  size_t i = 0;
+  for (; i+MIXER_SEED_ELEMS <= numElems; i += MIXER_SEED_ELEMS)
+    {
+      const double p0 = phase + i*step;
+      const double p1 = p0 + step;
+      __m128 vP = _mm_setr_ps(float(std::cos(p0)), float(std::sin(p0)), float(std::cos(p1)), float(std::sin(p1)));
+      for (size_t k = i; k < i+MIXER_SEED_ELEMS; k += 2)
+        {
+          const __m128 x = _mm_loadu_ps(src+k*2);
+          const __m128 pReal = _mm_shuffle_ps(vP, vP, _MM_SHUFFLE(2, 2, 0, 0));
+          const __m128 pImag = _mm_mul_ps(_mm_shuffle_ps(vP, vP, _MM_SHUFFLE(3, 3, 1, 1)), vSign);
+          const __m128 xSwapped = _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1));
+          _mm_storeu_ps(dst+k*2, _mm_add_ps(_mm_mul_ps(x, pReal), _mm_mul_ps(xSwapped, pImag)));
+          const __m128 pSwapped = _mm_shuffle_ps(vP, vP, _MM_SHUFFLE(2, 3, 0, 1));
+          vP = _mm_add_ps(_mm_mul_ps(vP, vRotReal), _mm_mul_ps(pSwapped, vRotImag));
+        }
+    }
+
+  genericMixer(src+i*2, dst+i*2, numElems-i, phase + i*step, step);
+}
+#endif //SOAPY_SDR_CONVERTER_X86
+
+static MixerKernel selectMixer(void)
+{
+  #ifdef SOAPY_SDR_CONVERTER_X86
+  if (SoapySDR::ConverterRegistry::getInstructionSet() >= SoapySDR::ConverterRegistry::ISA_SSE2) return &sse2Mixer;
+  #endif
+  return &genericMixer;
+}
+
+/***********************************************************************
+ * Decimation kernels
+ *
+ * Each output element m filters the CF32 input history starting at
+ * element m*factor. Two outputs per SSE2 vector: [I(m), Q(m), I(m+1), Q(m+1)],
+ * where each tap loads the two input elements that are factor apart.
+ **********************************************************************/
+//half-band taps at the odd offsets 1, 3, ... 15 from the center, the center tap is 0.5
+//Kaiser window (beta 9) sinc, normalized for unity gain at DC
+static const size_t HALF_BAND_NUM_TAPS = 31;
+static const size_t HALF_BAND_CENTER = 15;
+static const float HALF_BAND_TAPS[] = {
+  3.123496674e-01f,
+  -8.939628904e-02f,
+  3.922241209e-02f,
+  -1.712389090e-02f,
+  6.562495317e-03f,
+  -1.982948328e-03f,
+  3.879575053e-04f,
+  -1.940405764e-05f
+};
+
+struct DecimationKernels
+{
+  void (*halfBand)(const float *in, float *out, const size_t numOut);
+  void (*fir)(const float *in, float *out, const size_t numOut, const float *taps, const size_t numTaps, const size_t factor);
+};
+
+static void genericHalfBand(const float *in, float *out, const size_t numOut)
+{
+  for (size_t m = 0; m < numOut; m++)
+    {
+      const float *center = in + (m*2 + HALF_BAND_CENTER)*2;
+      float I = 0.5f*center[0];
+      float Q = 0.5f*center[1];
+      for (size_t k = 0; k < HALF_BAND_CENTER/2+1; k++)
+        {
+          const size_t off = (k*2+1)*2;
+          I += HALF_BAND_TAPS[k]*(center[-ptrdiff_t(off)+0] + center[off+0]);
+          Q += HALF_BAND_TAPS[k]*(center[-ptrdiff_t(off)+1] + center[off+1]);
+        }
+      out[m*2+0] = I;
+      out[m*2+1] = Q;
+    }
+}
+
+static void genericFirDecimate(const float *in, float *out, const size_t numOut, const float *taps, const size_t numTaps, const size_t factor)
+{
+  for (size_t m = 0; m < numOut; m++)
+    {
+      const float *x = in + m*factor*2;
+      float I = 0.0f, Q = 0.0f;
+      for (size_t t = 0; t < numTaps; t++)
+        {
+          I += taps[t]*x[t*2+0];
+          Q += taps[t]*x[t*2+1];
+        }
+      out[m*2+0] = I;
+      out[m*2+1] = Q;
+    }
+}
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+//load element i and element i+stride of a CF32 buffer into one vector
+static SOAPY_SDR_TARGET_SSE2 inline __m128 sse2LoadPair(const float *p, const size_t stride)
+{
+  return _mm_loadh_pi(_mm_castpd_ps(_mm_load_sd((const double *)p)), (const __m64 *)(p+stride*2));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2HalfBand(const float *in, float *out, const size_t numOut)
+{
+  size_t m = 0;
+  for (; m+2 <= numOut; m += 2)
+    {
+      const float *center = in + (m*2 + HALF_BAND_CENTER)*2;
+      __m128 acc = _mm_mul_ps(_mm_set1_ps(0.5f), sse2LoadPair(center, 2));
+      for (size_t k = 0; k < HALF_BAND_CENTER/2+1; k++)
+        {
+          const size_t off = (k*2+1)*2;
+          const __m128 sum = _mm_add_ps(sse2LoadPair(center-off, 2), sse2LoadPair(center+off, 2));
+          acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(HALF_BAND_TAPS[k]), sum));
+        }
+      _mm_storeu_ps(out+m*2, acc);
+    }
+
+  genericHalfBand(in+m*4, out+m*2, numOut-m);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2FirDecimate(const float *in, float *out, const size_t numOut, const float *taps, const size_t numTaps, const size_t factor)
+{
+  size_t m = 0;
+  for (; m+2 <= numOut; m += 2)
+    {
+      const float *x = in + m*factor*2;
+      __m128 acc = _mm_setzero_ps();
+      for (size_t t = 0; t < numTaps; t++)
+        {
+          acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(taps[t]), sse2LoadPair(x+t*2, factor)));
+        }
+      _mm_storeu_ps(out+m*2, acc);
+    }
+
+  genericFirDecimate(in+m*factor*2, out+m*2, numOut-m, taps, numTaps, factor);
+}
+#endif //SOAPY_SDR_CONVERTER_X86
+
+static DecimationKernels selectDecimation(void)
+{
+  #ifdef SOAPY_SDR_CONVERTER_X86
+  if (SoapySDR::ConverterRegistry::getInstructionSet() >= SoapySDR::ConverterRegistry::ISA_SSE2) return {&sse2HalfBand, &sse2FirDecimate};
+  #endif
+  return {&genericHalfBand, &genericFirDecimate};
+}
+
+/***********************************************************************
+ * Saturating kernels
+ *
+ * Narrow a flat array of parts, clipping to the target range,
+ * and return the number of clipped parts. The SSE2 kernels count with
+ * per-lane compare masks, which are summed once at the end.
+ **********************************************************************/
+enum SaturatingKernelType
+{
+  SATURATE_F32_TO_S16,
+  SATURATE_F32_TO_S8,
+  SATURATE_F32_TO_U8,
+  SATURATE_S16_TO_S8,
+};
+
+struct SaturatingKernels
+{
+  size_t (*f32toS16)(const float *src, int16_t *dst, const size_t numParts, const float scale);
+  size_t (*f32toS8)(const float *src, int8_t *dst, const size_t numParts, const float scale, const uint8_t offset);
+  size_t (*s16toS8)(const int16_t *src, int8_t *dst, const size_t numParts, const float scale);
+};
+
+template <typename T>
+static inline T saturate(const float from, const float min, const float max, size_t &numClipped)
+{
+  if (from > max) {numClipped++; return T(max);}
+  if (from < min) {numClipped++; return T(min);}
+  return T(from);
+}
+
+static size_t genericSaturateF32toS16(const float *src, int16_t *dst, const size_t numParts, const float scale)
+{
+  size_t numClipped = 0;
+  for (size_t i = 0; i < numParts; i++)
+    {
+      dst[i] = saturate<int16_t>(src[i]*scale, -32768.0f, 32767.0f, numClipped);
+    }
+  return numClipped;
+}
+
+static size_t genericSaturateF32toS8(const float *src, int8_t *dst, const size_t numParts, const float scale, const uint8_t offset)
+{
+  size_t numClipped = 0;
+  for (size_t i = 0; i < numParts; i++)
+    {
+      dst[i] = int8_t(saturate<int8_t>(src[i]*scale, -128.0f, 127.0f, numClipped) ^ offset);
+    }
+  return numClipped;
+}
+
+static size_t genericSaturateS16toS8(const int16_t *src, int8_t *dst, const size_t numParts, const float scale)
+{
+  size_t numClipped = 0;
+  for (size_t i = 0; i < numParts; i++)
+    {
+      dst[i] = int8_t(saturate<int16_t>(src[i]*scale, -32768.0f, 32767.0f, numClipped) >> 8);
+    }
+  return numClipped;
+}
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+//clamp a scaled vector to [vMin, vMax] and count the clipped lanes into vCount
+static SOAPY_SDR_TARGET_SSE2 inline __m128i sse2SaturateCount(const __m128 in, const __m128 vMin, const __m128 vMax, __m128i &vCount)
+{
+  const __m128 clipped = _mm_or_ps(_mm_cmpgt_ps(in, vMax), _mm_cmplt_ps(in, vMin));
+  vCount = _mm_sub_epi32(vCount, _mm_castps_si128(clipped));
+  return _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(in, vMin), vMax));
+}
+
+static SOAPY_SDR_TARGET_SSE2 inline size_t sse2SumCount(const __m128i vCount)
+{
+  alignas(16) uint32_t counts[4];
+  _mm_store_si128((__m128i *)counts, vCount);
+  return size_t(counts[0]) + counts[1] + counts[2] + counts[3];
+}
+
+static SOAPY_SDR_TARGET_SSE2 size_t sse2SaturateF32toS16(const float *src, int16_t *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMax = _mm_set1_ps(32767.0f);
+  const __m128 vMin = _mm_set1_ps(-32768.0f);
+  __m128i vCount = _mm_setzero_si128();
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128i a = sse2SaturateCount(_mm_mul_ps(_mm_loadu_ps(src+i+0), vScale), vMin, vMax, vCount);
+      const __m128i b = sse2SaturateCount(_mm_mul_ps(_mm_loadu_ps(src+i+4), vScale), vMin, vMax, vCount);
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_packs_epi32(a, b));
+    }
+
+  return sse2SumCount(vCount) + genericSaturateF32toS16(src+i, dst+i, numParts-i, scale);
+}
+
+static SOAPY_SDR_TARGET_SSE2 size_t sse2SaturateF32toS8(const float *src, int8_t *dst, const size_t numParts, const float scale, const uint8_t offset)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMax = _mm_set1_ps(127.0f);
+  const __m128 vMin = _mm_set1_ps(-128.0f);
+  const __m128i vOffset = _mm_set1_epi8(int8_t(offset));
+  __m128i vCount = _mm_setzero_si128();
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m128i a = sse2SaturateCount(_mm_mul_ps(_mm_loadu_ps(src+i+0), vScale), vMin, vMax, vCount);
+      const __m128i b = sse2SaturateCount(_mm_mul_ps(_mm_loadu_ps(src+i+4), vScale), vMin, vMax, vCount);
+      const __m128i c = sse2SaturateCount(_mm_mul_ps(_mm_loadu_ps(src+i+8), vScale), vMin, vMax, vCount);
+      const __m128i d = sse2SaturateCount(_mm_mul_ps(_mm_loadu_ps(src+i+12), vScale), vMin, vMax, vCount);
+      const __m128i out = _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(out, vOffset));
+    }
+
+  return sse2SumCount(vCount) + genericSaturateF32toS8(src+i, dst+i, numParts-i, scale, offset);
+}
+
+static SOAPY_SDR_TARGET_SSE2 size_t sse2SaturateS16toS8(const int16_t *src, int8_t *dst, const size_t numParts, const float scale)
+{
+  size_t i = 0;
+
+  //without scaling, the shift can not overflow
+  if (scale == 1.0f)
+    {
+      for (; i+16 <= numParts; i += 16)
+        {
+          const __m128i a = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)(src+i+0)), 8);
+          const __m128i b = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)(src+i+8)), 8);
+          _mm_storeu_si128((__m128i *)(dst+i), _mm_packs_epi16(a, b));
+        }
+      return genericSaturateS16toS8(src+i, dst+i, numParts-i, scale);
+    }
+
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMax = _mm_set1_ps(32767.0f);
+  const __m128 vMin = _mm_set1_ps(-32768.0f);
+  __m128i vCount = _mm_setzero_si128();
+
+  for (; i+8 <= numParts; i += 8)
+    {
+      //sign extend the 16-bit parts into 32-bit lanes
+      const __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+      const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+      const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+      const __m128i a = sse2SaturateCount(_mm_mul_ps(_mm_cvtepi32_ps(lo), vScale), vMin, vMax, vCount);
+      const __m128i b = sse2SaturateCount(_mm_mul_ps(_mm_cvtepi32_ps(hi), vScale), vMin, vMax, vCount);
+      const __m128i out = _mm_srai_epi16(_mm_packs_epi32(a, b), 8);
+      _mm_storel_epi64((__m128i *)(dst+i), _mm_packs_epi16(out, out));
+    }
+
+  return sse2SumCount(vCount) + genericSaturateS16toS8(src+i, dst+i, numParts-i, scale);
+}
+#endif //SOAPY_SDR_CONVERTER_X86
+
+static SaturatingKernels selectSaturating(void)
+{
+  #ifdef SOAPY_SDR_CONVERTER_X86
+  if (SoapySDR::ConverterRegistry::getInstructionSet() >= SoapySDR::ConverterRegistry::ISA_SSE2) return {&sse2SaturateF32toS16, &sse2SaturateF32toS8, &sse2SaturateS16toS8};
+  #endif
+  return {&genericSaturateF32toS16, &genericSaturateF32toS8, &genericSaturateS16toS8};
+}
+
+/***********************************************************************
+ * Complex scaler conversion
+ *
+ * The Converter handle applies a complex scaler as a stage on CF32,
+ * after converting to CF32 or before converting from CF32.
+ **********************************************************************/
+void SoapySDR::Converter::convert(const void *srcBuff, void *dstBuff, const size_t numElems, const std::complex<double> &scaler) const
+{
+  //the formats are checked first, so a complex scaler conversion fails for any scaler
+  if (_sourceFormat != SOAPY_SDR_CF32 and _targetFormat != SOAPY_SDR_CF32)
+    {
+      throw std::runtime_error("Converter::convert() complex scaler requires a CF32 source or target; "
+                               "sourceFormat="+_sourceFormat+", targetFormat="+_targetFormat);
+    }
+
+  if (scaler.imag() == 0.0) return this->convert(srcBuff, dstBuff, numElems, scaler.real());
+
+  static const ComplexScalerKernel kernel = selectComplexScaler();
+  const float sr = float(scaler.real());
+  const float si = float(scaler.imag());
+  const bool srcPlanar = isPlanarFormat(_sourceFormat);
+  const bool dstPlanar = isPlanarFormat(_targetFormat);
+  const void *srcPlanes[2];
+  void *dstPlanes[2];
+
+  if (_sourceFormat == SOAPY_SDR_CF32 and _targetFormat == SOAPY_SDR_CF32)
+    {
+      kernel((const float *)srcBuff, (float *)dstBuff, numElems, sr, si);
+    }
+  else if (_targetFormat == SOAPY_SDR_CF32)
+    {
+      for (size_t offset = 0; offset < numElems; offset += STAGE_CHUNK_ELEMS)
+        {
+          const size_t n = std::min(STAGE_CHUNK_ELEMS, numElems-offset);
+          auto *out = (float *)dstBuff + offset*2;
+          this->convert(offsetBuffer(srcBuff, srcPlanar, _sourceElemSize, offset, srcPlanes), out, n, 1.0);
+          kernel(out, out, n, sr, si);
+        }
+    }
+  else
+    {
+      float staging[STAGE_CHUNK_ELEMS*2];
+      for (size_t offset = 0; offset < numElems; offset += STAGE_CHUNK_ELEMS)
+        {
+          const size_t n = std::min(STAGE_CHUNK_ELEMS, numElems-offset);
+          kernel((const float *)srcBuff + offset*2, staging, n, sr, si);
+          this->convert(staging, offsetBuffer(dstBuff, dstPlanar, _targetElemSize, offset, dstPlanes), n, 1.0);
+        }
+    }
+}
+
+void SoapySDR::Converter::convertBatch(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const std::complex<double> *scalers) const
+{
+  if (this->isStateful())
+    {
+      throw std::runtime_error("Converter::convertBatch() not supported for stateful functions, use one Converter per channel; "
+                               "sourceFormat="+_sourceFormat+", targetFormat="+_targetFormat);
+    }
+
+  for (size_t ch = 0; ch < numChans; ch++)
+    {
+      this->convert(srcBuffs[ch], dstBuffs[ch], numElems, scalers[ch]);
+    }
+}
+
+/***********************************************************************
+ * IQ correction converter
+ **********************************************************************/
+SoapySDR::IQCorrectionConverter::IQCorrectionConverter(const std::string &sourceFormat):
+  _converter(sourceFormat, SOAPY_SDR_CF32),
+  _dcOffsetMode(false),
+  _iqBalanceMode(false),
+  _trackingLength(65536)
+{
+  return;
+}
+
+void SoapySDR::IQCorrectionConverter::setDCOffsetMode(const bool automatic)
+{
+  _dcOffsetMode = automatic;
+}
+
+void SoapySDR::IQCorrectionConverter::setDCOffset(const std::complex<double> &offset)
+{
+  _dcOffset = offset;
+}
+
+void SoapySDR::IQCorrectionConverter::setIQBalanceMode(const bool automatic)
+{
+  _iqBalanceMode = automatic;
+}
+
+void SoapySDR::IQCorrectionConverter::setIQBalance(const std::complex<double> &balance)
+{
+  _iqBalance = balance;
+}
+
+void SoapySDR::IQCorrectionConverter::setTrackingLength(const size_t numElems)
+{
+  _trackingLength = std::max<size_t>(numElems, 1);
+}
+
+void SoapySDR::IQCorrectionConverter::reset(void)
+{
+  if (_dcOffsetMode) _dcOffset = 0.0;
+  if (_iqBalanceMode) _iqBalance = 0.0;
+  _converter.reset();
+}
+
+void SoapySDR::IQCorrectionConverter::convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  static const IQCorrectionKernel kernel = selectIQCorrection();
+
+  auto *dst = (float *)dstBuff;
+  const size_t srcElemSize = _converter.getSourceElementSize();
+  const bool srcPlanar = isPlanarFormat(_converter.getSourceFormat());
+  const void *srcPlanes[2];
+
+  for (size_t offset = 0; offset < numElems; offset += STAGE_CHUNK_ELEMS)
+    {
+      const size_t n = std::min(STAGE_CHUNK_ELEMS, numElems-offset);
+      float *out = dst + offset*2;
+      _converter.convert(offsetBuffer(srcBuff, srcPlanar, srcElemSize, offset, srcPlanes), out, n, scaler);
+
+      const float dc[2] = {float(_dcOffset.real()), float(_dcOffset.imag())};
+      const float a = float(1.0 + _iqBalance.real());
+      const float b = float(_iqBalance.imag());
+      const float d = float(1.0 - _iqBalance.real());
+      IQCorrectionSums sums;
+      kernel(out, n, dc, a, b, d, sums);
+
+      //move each estimate toward the chunk measurement by the chunk's share of the tracking length
+      const double weight = std::min(1.0, double(n)/_trackingLength);
+      if (_dcOffsetMode)
+        {
+          const std::complex<double> mean(sums.sumI/n, sums.sumQ/n);
+          _dcOffset += weight*(mean - _dcOffset);
+        }
+      const double power = sums.powII + sums.powQQ;
+      if (_iqBalanceMode and power > 0.0)
+        {
+          //the image term of y = x + balance*conj(x) leaves E[y^2] = E[x^2] + 2*balance*E[|x|^2]
+          const std::complex<double> moment(sums.powII - sums.powQQ, 2*sums.powIQ);
+          _iqBalance -= weight*moment/(2*power);
+        }
+    }
+}
+
+/***********************************************************************
+ * Mixer converter
+ **********************************************************************/
+SoapySDR::MixerConverter::MixerConverter(const std::string &sourceFormat, const std::string &targetFormat):
+  _converter(sourceFormat, targetFormat),
+  _frequency(0.0),
+  _phase(0.0)
+{
+  if (sourceFormat != SOAPY_SDR_CF32 and targetFormat != SOAPY_SDR_CF32)
+    {
+      throw std::runtime_error("MixerConverter() requires a CF32 source or target; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+}
+
+void SoapySDR::MixerConverter::setFrequency(const double frequency)
+{
+  _frequency = frequency;
+}
+
+void SoapySDR::MixerConverter::setPhase(const double phase)
+{
+  _phase = std::remainder(phase, MIXER_TWO_PI);
+}
+
+void SoapySDR::MixerConverter::reset(void)
+{
+  _phase = 0.0;
+  _converter.reset();
+}
+
+void SoapySDR::MixerConverter::convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  static const MixerKernel kernel = selectMixer();
+  const double step = MIXER_TWO_PI*_frequency;
+  const size_t srcElemSize = _converter.getSourceElementSize();
+  const size_t dstElemSize = _converter.getTargetElementSize();
+  const bool srcPlanar = isPlanarFormat(_converter.getSourceFormat());
+  const bool dstPlanar = isPlanarFormat(_converter.getTargetFormat());
+  const void *srcPlanes[2];
+  void *dstPlanes[2];
+  float staging[STAGE_CHUNK_ELEMS*2];
+
+  for (size_t offset = 0; offset < numElems; offset += STAGE_CHUNK_ELEMS)
+    {
+      const size_t n = std::min(STAGE_CHUNK_ELEMS, numElems-offset);
+      if (_converter.getTargetFormat() == SOAPY_SDR_CF32)
+        {
+          auto *out = (float *)dstBuff + offset*2;
+          _converter.convert(offsetBuffer(srcBuff, srcPlanar, srcElemSize, offset, srcPlanes), out, n, scaler);
+          kernel(out, out, n, _phase, step);
+        }
+      else
+        {
+          kernel((const float *)srcBuff + offset*2, staging, n, _phase, step);
+          _converter.convert(staging, offsetBuffer(dstBuff, dstPlanar, dstElemSize, offset, dstPlanes), n, scaler);
+        }
+      _phase = std::remainder(_phase + n*step, MIXER_TWO_PI);
+    }
+}
+
+/***********************************************************************
+ * Decimating converter
+ **********************************************************************/
+//the order of the CIC-shaped filter for the odd part of the factor
+static const size_t CIC_ORDER = 4;
+
+SoapySDR::DecimatingConverter::DecimatingConverter(const std::string &sourceFormat, const size_t factor):
+  _converter(sourceFormat, SOAPY_SDR_CF32),
+  _factor(factor)
+{
+  if (factor == 0) throw std::runtime_error("DecimatingConverter() factor must be at least 1");
+
+  size_t oddFactor = factor;
+  while (oddFactor % 2 == 0) oddFactor /= 2;
+
+  //the odd part: a boxcar of length oddFactor convolved with itself CIC_ORDER times
+  if (oddFactor > 1)
+    {
+      Stage stage;
+      stage.factor = oddFactor;
+      stage.numElems = 0;
+      stage.taps.assign(1, 1.0f);
+      for (size_t n = 0; n < CIC_ORDER; n++)
+        {
+          std::vector<float> taps(stage.taps.size()+oddFactor-1, 0.0f);
+          for (size_t i = 0; i < stage.taps.size(); i++)
+            {
+              for (size_t j = 0; j < oddFactor; j++) taps[i+j] += stage.taps[i]/oddFactor;
+            }
+          stage.taps.swap(taps);
+        }
+      _stages.push_back(stage);
+    }
+
+  //the power of two: one half-band stage per factor of two
+  for (size_t f = factor/oddFactor; f > 1; f /= 2)
+    {
+      Stage stage;
+      stage.factor = 2;
+      stage.numElems = 0;
+      _stages.push_back(stage);
+    }
+
+  //each stage receives at most one chunk of elements per pass
+  for (auto &stage : _stages)
+    {
+      const size_t numTaps = stage.taps.empty() ? HALF_BAND_NUM_TAPS : stage.taps.size();
+      stage.buffer.resize((STAGE_CHUNK_ELEMS + numTaps)*2);
+    }
+  this->reset();
+}
+
+void SoapySDR::DecimatingConverter::reset(void)
+{
+  //prime each history with zeros so that the first input produces an output
+  for (auto &stage : _stages)
+    {
+      stage.numElems = (stage.taps.empty() ? HALF_BAND_NUM_TAPS : stage.taps.size()) - 1;
+      std::fill(stage.buffer.begin(), stage.buffer.end(), 0.0f);
+    }
+  _converter.reset();
+}
+
+size_t SoapySDR::DecimatingConverter::convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  if (_stages.empty())
+    {
+      _converter.convert(srcBuff, dstBuff, numElems, scaler);
+      return numElems;
+    }
+
+  static const DecimationKernels kernels = selectDecimation();
+  auto *dst = (float *)dstBuff;
+  const size_t srcElemSize = _converter.getSourceElementSize();
+  const bool srcPlanar = isPlanarFormat(_converter.getSourceFormat());
+  const void *srcPlanes[2];
+  size_t numOut = 0;
+
+  for (size_t offset = 0; offset < numElems; offset += STAGE_CHUNK_ELEMS)
+    {
+      //convert straight into the history of the first stage
+      const size_t n = std::min(STAGE_CHUNK_ELEMS, numElems-offset);
+      Stage &first = _stages.front();
+      _converter.convert(offsetBuffer(srcBuff, srcPlanar, srcElemSize, offset, srcPlanes), first.buffer.data() + first.numElems*2, n, scaler);
+      first.numElems += n;
+
+      //each stage filters into the history of the next, the last one into the output
+      for (size_t i = 0; i < _stages.size(); i++)
+        {
+          Stage &stage = _stages[i];
+          const size_t numTaps = stage.taps.empty() ? HALF_BAND_NUM_TAPS : stage.taps.size();
+          if (stage.numElems < numTaps) break;
+          const size_t produced = (stage.numElems - numTaps)/stage.factor + 1;
+
+          const bool last = (i+1 == _stages.size());
+          float *out = last ? dst + numOut*2 : _stages[i+1].buffer.data() + _stages[i+1].numElems*2;
+          if (stage.taps.empty()) kernels.halfBand(stage.buffer.data(), out, produced);
+          else kernels.fir(stage.buffer.data(), out, produced, stage.taps.data(), numTaps, stage.factor);
+          if (last) numOut += produced;
+          else _stages[i+1].numElems += produced;
+
+          //keep the unconsumed elements as the history for the next pass
+          const size_t consumed = produced*stage.factor;
+          std::memmove(stage.buffer.data(), stage.buffer.data() + consumed*2, (stage.numElems - consumed)*2*sizeof(float));
+          stage.numElems -= consumed;
+        }
+    }
+
+  return numOut;
+}
+
+/***********************************************************************
+ * Saturating converter
+ **********************************************************************/
+SoapySDR::SaturatingConverter::SaturatingConverter(const std::string &sourceFormat, const std::string &targetFormat):
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _numParts(0),
+  _kernel(0),
+  _clipCount(0)
+{
+  struct Pair
+  {
+    const char *source;
+    const char *target;
+    size_t numParts;
+    SaturatingKernelType kernel;
+  };
+  static const Pair pairs[] = {
+    {SOAPY_SDR_F32, SOAPY_SDR_S16, 1, SATURATE_F32_TO_S16},
+    {SOAPY_SDR_CF32, SOAPY_SDR_CS16, 2, SATURATE_F32_TO_S16},
+    {SOAPY_SDR_F32, SOAPY_SDR_S8, 1, SATURATE_F32_TO_S8},
+    {SOAPY_SDR_CF32, SOAPY_SDR_CS8, 2, SATURATE_F32_TO_S8},
+    {SOAPY_SDR_F32, SOAPY_SDR_U8, 1, SATURATE_F32_TO_U8},
+    {SOAPY_SDR_CF32, SOAPY_SDR_CU8, 2, SATURATE_F32_TO_U8},
+    {SOAPY_SDR_S16, SOAPY_SDR_S8, 1, SATURATE_S16_TO_S8},
+    {SOAPY_SDR_CS16, SOAPY_SDR_CS8, 2, SATURATE_S16_TO_S8},
+  };
+
+  for (const auto &pair : pairs)
+    {
+      if (sourceFormat != pair.source or targetFormat != pair.target) continue;
+      _numParts = pair.numParts;
+      _kernel = pair.kernel;
+      return;
+    }
+
+  throw std::runtime_error("SaturatingConverter() conversion not supported; "
+                           "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+}
+
+void SoapySDR::SaturatingConverter::resetClipCount(void)
+{
+  _clipCount = 0;
+}
+
+size_t SoapySDR::SaturatingConverter::convert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  static const SaturatingKernels kernels = selectSaturating();
+  const size_t numParts = numElems*_numParts;
+  size_t numClipped = 0;
+
+  switch (SaturatingKernelType(_kernel))
+    {
+    case SATURATE_F32_TO_S16:
+      numClipped = kernels.f32toS16((const float *)srcBuff, (int16_t *)dstBuff, numParts, float(scaler*SoapySDR::S16_FULL_SCALE));
+      break;
+    case SATURATE_F32_TO_S8:
+      numClipped = kernels.f32toS8((const float *)srcBuff, (int8_t *)dstBuff, numParts, float(scaler*SoapySDR::S8_FULL_SCALE), 0);
+      break;
+    case SATURATE_F32_TO_U8:
+      numClipped = kernels.f32toS8((const float *)srcBuff, (int8_t *)dstBuff, numParts, float(scaler*SoapySDR::S8_FULL_SCALE), SoapySDR::U8_ZERO_OFFSET);
+      break;
+    case SATURATE_S16_TO_S8:
+      numClipped = kernels.s16toS8((const int16_t *)srcBuff, (int8_t *)dstBuff, numParts, float(scaler));
+      break;
+    }
+
+  _clipCount += numClipped;
+  return numClipped;
+}
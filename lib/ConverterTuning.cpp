@@ -0,0 +1,316 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <SoapySDR/Version.hpp>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+std::string getEnvImpl(const char *name);
+
+/***********************************************************************
+ * Tuning cache file
+ *
+ * One line per decision, appended as decisions are made:
+ * library version, instruction set, source, target, elements, priority.
+ * Lines from another library version or instruction set are ignored,
+ * since the registered functions may differ; later lines win.
+ **********************************************************************/
+static const char *isaName(const SoapySDR::ConverterRegistry::InstructionSet isa)
+{
+  switch (isa)
+    {
+    case SoapySDR::ConverterRegistry::ISA_GENERIC: return "generic";
+    case SoapySDR::ConverterRegistry::ISA_SSE2: return "sse2";
+    case SoapySDR::ConverterRegistry::ISA_SSE41: return "sse4.1";
+    case SoapySDR::ConverterRegistry::ISA_AVX2: return "avx2";
+    case SoapySDR::ConverterRegistry::ISA_AVX512: return "avx512";
+    }
+  return "unknown";
+}
+
+static std::string getHostName(void)
+{
+  std::string name;
+#ifdef _WIN32
+  name = getEnvImpl("COMPUTERNAME");
+#else
+  char buff[256] = {};
+  if (gethostname(buff, sizeof(buff)-1) == 0) name = buff;
+#endif
+  for (auto &ch : name)
+    {
+      if (not std::isalnum((unsigned char)ch) and ch != '-' and ch != '.') ch = '_';
+    }
+  return name.empty()?"localhost":name;
+}
+
+static void makeDirectory(const std::string &path)
+{
+  //errors are ignored, the directory usually exists already
+#ifdef _WIN32
+  _mkdir(path.c_str());
+#else
+  mkdir(path.c_str(), 0755);
+#endif
+}
+
+//the cache file, named for the host since the home directory may be shared between hosts
+static std::string getCachePath(void)
+{
+  const std::string path = getEnvImpl("SOAPY_SDR_CONVERTER_CACHE");
+  if (not path.empty()) return path;
+
+#ifdef _WIN32
+  std::string dir = getEnvImpl("LOCALAPPDATA");
+  if (dir.empty()) return "";
+  dir += "\\SoapySDR";
+  makeDirectory(dir);
+  return dir + "\\converters-" + getHostName() + ".cache";
+#else
+  std::string dir = getEnvImpl("XDG_CACHE_HOME");
+  if (dir.empty())
+    {
+      const std::string home = getEnvImpl("HOME");
+      if (home.empty()) return "";
+      dir = home + "/.cache";
+      makeDirectory(dir);
+    }
+  dir += "/SoapySDR";
+  makeDirectory(dir);
+  return dir + "/converters-" + getHostName() + ".cache";
+#endif
+}
+
+typedef std::tuple<std::string, std::string, size_t> TuningKey;
+
+struct TuningCache
+{
+  TuningCache(void):
+    loaded(false)
+  {}
+
+  std::mutex mutex;
+  bool loaded;
+  std::string path;
+  std::map<TuningKey, SoapySDR::ConverterRegistry::FunctionPriority> priorities;
+};
+
+static TuningCache &getTuningCache(void)
+{
+  static TuningCache cache;
+  return cache;
+}
+
+static void loadTuningCache(TuningCache &cache)
+{
+  cache.loaded = true;
+  cache.path = getCachePath();
+  if (cache.path.empty()) return;
+
+  const std::string version = SoapySDR::getLibVersion();
+  const std::string isa = isaName(SoapySDR::ConverterRegistry::getInstructionSet());
+  std::ifstream file(cache.path);
+  std::string line;
+  while (std::getline(file, line))
+    {
+      if (line.empty() or line[0] == '#') continue;
+      std::istringstream fields(line);
+      std::string lineVersion, lineIsa, source, target;
+      size_t numElems;
+      int priority;
+      if (not (fields >> lineVersion >> lineIsa >> source >> target >> numElems >> priority)) continue;
+      if (lineVersion != version or lineIsa != isa) continue;
+      cache.priorities[TuningKey(source, target, numElems)] = SoapySDR::ConverterRegistry::FunctionPriority(priority);
+    }
+}
+
+static void storeTuningCache(TuningCache &cache, const TuningKey &key, const SoapySDR::ConverterRegistry::FunctionPriority priority)
+{
+  cache.priorities[key] = priority;
+  if (cache.path.empty()) return;
+
+  FILE *file = fopen(cache.path.c_str(), "a");
+  if (file == nullptr)
+    {
+      SoapySDR::logf(SOAPY_SDR_DEBUG, "Converter tuning cache %s not writable", cache.path.c_str());
+      return;
+    }
+  fseek(file, 0, SEEK_END);
+  if (ftell(file) == 0) fprintf(file, "# SoapySDR converter tuning cache: version isa source target elements priority\n");
+  fprintf(file, "%s %s %s %s %zu %d\n",
+    SoapySDR::getLibVersion().c_str(), isaName(SoapySDR::ConverterRegistry::getInstructionSet()),
+    std::get<0>(key).c_str(), std::get<1>(key).c_str(), std::get<2>(key), int(priority));
+  fclose(file);
+}
+
+/***********************************************************************
+ * Measurement
+ **********************************************************************/
+//each trial runs for at least this long, so the clock resolution does not matter
+static const double TUNING_TRIAL_TIME = 100e-6;
+
+//trials are interleaved between priorities, and the fastest trial counts
+static const size_t TUNING_NUM_TRIALS = 7;
+
+//a lower priority is only chosen when it is clearly faster than the default
+static const double TUNING_MARGIN = 0.95;
+
+//a buffer in a format, with a plane pointer array for planar formats
+struct TuningBuffer
+{
+  TuningBuffer(const std::string &format, const size_t numElems):
+    planar(format.find("_PLANAR") != std::string::npos),
+    data(SoapySDR::formatToSize(format)*numElems)
+  {
+    planes[0] = data.data();
+    planes[1] = data.data() + data.size()/2;
+  }
+
+  void *get(void)
+  {
+    return planar?(void *)planes:planes[0];
+  }
+
+  //fill floats with small values (no denormals or NaNs), and other formats with a byte pattern
+  void fill(const std::string &format)
+  {
+    const bool isFloat = (format[0] == 'F' or format.compare(0, 2, "CF") == 0);
+    const size_t partSize = SoapySDR::formatToSize(format)/((format[0] == 'C')?2:1);
+    if (not isFloat)
+      {
+        for (size_t i = 0; i < data.size(); i++) data[i] = uint8_t(i*37 + 11);
+        return;
+      }
+    for (size_t i = 0; i < data.size()/partSize; i++)
+      {
+        const float value = float(int(i % 199) - 99)/128;
+        if (partSize == 2)
+          {
+            const uint16_t half = SoapySDR::F32toF16(value);
+            std::memcpy(data.data() + i*2, &half, 2);
+          }
+        else if (partSize == 4) std::memcpy(data.data() + i*4, &value, 4);
+        else
+          {
+            const double dbl = value;
+            std::memcpy(data.data() + i*8, &dbl, 8);
+          }
+      }
+  }
+
+  bool planar;
+  std::vector<uint8_t> data;
+  uint8_t *planes[2];
+};
+
+//the average time of one call, over repeated calls for a trial
+static double measureTrial(SoapySDR::ConverterRegistry::ConverterFunction function, const void *src, void *dst, const size_t numElems)
+{
+  size_t numCalls = 0;
+  double elapsed = 0.0;
+  const auto start = std::chrono::steady_clock::now();
+  do
+    {
+      function(src, dst, numElems, 1.0);
+      numCalls++;
+      elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+  while (elapsed < TUNING_TRIAL_TIME);
+  return elapsed/numCalls;
+}
+
+static SoapySDR::ConverterRegistry::FunctionPriority measurePriority(
+  const std::string &sourceFormat, const std::string &targetFormat, const size_t numElems,
+  const std::vector<SoapySDR::ConverterRegistry::FunctionPriority> &priorities)
+{
+  TuningBuffer src(sourceFormat, numElems);
+  TuningBuffer dst(targetFormat, numElems);
+  src.fill(sourceFormat);
+
+  std::vector<SoapySDR::ConverterRegistry::ConverterFunction> functions;
+  for (const auto priority : priorities)
+    {
+      functions.push_back(SoapySDR::ConverterRegistry::getFunction(sourceFormat, targetFormat, priority));
+      functions.back()(src.get(), dst.get(), numElems, 1.0); //warm up the caches and any lazy tables
+    }
+
+  std::vector<double> times(priorities.size(), 1e300);
+  for (size_t trial = 0; trial < TUNING_NUM_TRIALS; trial++)
+    {
+      for (size_t i = 0; i < functions.size(); i++)
+        {
+          times[i] = std::min(times[i], measureTrial(functions[i], src.get(), dst.get(), numElems));
+        }
+    }
+
+  //the default is the highest priority, listed last
+  size_t best = priorities.size()-1;
+  double bestTime = times[best]*TUNING_MARGIN;
+  for (size_t i = 0; i < priorities.size(); i++)
+    {
+      if (times[i] < bestTime)
+        {
+          best = i;
+          bestTime = times[i];
+        }
+    }
+
+  for (size_t i = 0; i < priorities.size(); i++)
+    {
+      SoapySDR::logf(SOAPY_SDR_DEBUG, "Converter tuning %s to %s at %zu elements: priority %d %.3g elements/s%s",
+        sourceFormat.c_str(), targetFormat.c_str(), numElems, int(priorities[i]), numElems/times[i], (i == best)?" (chosen)":"");
+    }
+  return priorities[best];
+}
+
+/***********************************************************************
+ * Tuned priority lookup
+ **********************************************************************/
+SoapySDR::ConverterRegistry::FunctionPriority SoapySDR::ConverterRegistry::tunePriority(const std::string &sourceFormat, const std::string &targetFormat, const size_t numElems)
+{
+  const auto priorities = ConverterRegistry::listPriorities(sourceFormat, targetFormat);
+  if (priorities.empty())
+    {
+      throw std::runtime_error("ConverterRegistry::tunePriority() conversion not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+  if (priorities.size() == 1) return priorities.front();
+
+  auto &cache = getTuningCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (not cache.loaded) loadTuningCache(cache);
+
+  //a cached decision is only used while its priority is still registered
+  const TuningKey key(sourceFormat, targetFormat, std::max<size_t>(1, numElems));
+  const auto it = cache.priorities.find(key);
+  if (it != cache.priorities.end() and std::find(priorities.begin(), priorities.end(), it->second) != priorities.end())
+    {
+      return it->second;
+    }
+
+  const auto priority = measurePriority(sourceFormat, targetFormat, std::get<2>(key), priorities);
+  storeTuningCache(cache, key, priority);
+  return priority;
+}
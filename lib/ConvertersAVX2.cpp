@@ -0,0 +1,866 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterISA.hpp"
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+#include <immintrin.h>
+
+// ********************************
+// AVX2 Kernels
+//
+// Each kernel operates on a flat array of parts (numElems*elemDepth),
+// so the real and complex converters share the same loop body.
+// Loads and stores are unaligned and the remainder is handled in scalar.
+
+static inline int16_t clampF32toS16(const float from)
+{
+  if (from >= 32767.0f) return 32767;
+  if (from <= -32768.0f) return -32768;
+  return int16_t(from);
+}
+
+static inline int8_t clampF32toS8(const float from)
+{
+  if (from >= 127.0f) return 127;
+  if (from <= -128.0f) return -128;
+  return int8_t(from);
+}
+
+// S16 > F32
+static SOAPY_SDR_TARGET_AVX2 void avx2S16toF32Parts(const int16_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(src+i+0)));
+      const __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(src+i+8)));
+      _mm256_storeu_ps(dst+i+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), vScale));
+      _mm256_storeu_ps(dst+i+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(src[i]) * scale;
+    }
+}
+
+// U16 > F32
+static SOAPY_SDR_TARGET_AVX2 void avx2U16toF32Parts(const uint16_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+  const __m128i vOffset = _mm_set1_epi16(int16_t(SoapySDR::U16_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m256i lo = _mm256_cvtepi16_epi32(_mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i+0)), vOffset));
+      const __m256i hi = _mm256_cvtepi16_epi32(_mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i+8)), vOffset));
+      _mm256_storeu_ps(dst+i+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), vScale));
+      _mm256_storeu_ps(dst+i+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(SoapySDR::U16toS16(src[i])) * scale;
+    }
+}
+
+// F32 > S16
+static inline SOAPY_SDR_TARGET_AVX2 __m256i avx2F32toS16Pack(const float *src, const __m256 vScale)
+{
+  const __m256 vMax = _mm256_set1_ps(32767.0f);
+  const __m256 vMin = _mm256_set1_ps(-32768.0f);
+  const __m256 a = _mm256_mul_ps(_mm256_loadu_ps(src+0), vScale);
+  const __m256 b = _mm256_mul_ps(_mm256_loadu_ps(src+8), vScale);
+  const __m256i ia = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(a, vMin), vMax));
+  const __m256i ib = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(b, vMin), vMax));
+  //packs operates per 128-bit lane, restore the sample order afterwards
+  return _mm256_permute4x64_epi64(_mm256_packs_epi32(ia, ib), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toS16Parts(const float *src, int16_t *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      _mm256_storeu_si256((__m256i *)(dst+i), avx2F32toS16Pack(src+i, vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF32toS16(src[i] * scale);
+    }
+}
+
+// F32 > U16
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toU16Parts(const float *src, uint16_t *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+  const __m256i vOffset = _mm256_set1_epi16(int16_t(SoapySDR::U16_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      _mm256_storeu_si256((__m256i *)(dst+i), _mm256_xor_si256(avx2F32toS16Pack(src+i, vScale), vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::S16toU16(clampF32toS16(src[i] * scale));
+    }
+}
+
+// S8 > F32
+static inline SOAPY_SDR_TARGET_AVX2 void avx2S8x32toF32(const __m256i in, float *dst, const __m256 vScale)
+{
+  const __m128i lo = _mm256_castsi256_si128(in);
+  const __m128i hi = _mm256_extracti128_si256(in, 1);
+  _mm256_storeu_ps(dst+0, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(lo)), vScale));
+  _mm256_storeu_ps(dst+8, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(lo, 8))), vScale));
+  _mm256_storeu_ps(dst+16, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(hi)), vScale));
+  _mm256_storeu_ps(dst+24, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(hi, 8))), vScale));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2S8toF32Parts(const int8_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+32 <= numParts; i += 32)
+    {
+      avx2S8x32toF32(_mm256_loadu_si256((const __m256i *)(src+i)), dst+i, vScale);
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(src[i]) * scale;
+    }
+}
+
+// U8 > F32
+static SOAPY_SDR_TARGET_AVX2 void avx2U8toF32Parts(const uint8_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+  const __m256i vOffset = _mm256_set1_epi8(int8_t(SoapySDR::U8_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+32 <= numParts; i += 32)
+    {
+      avx2S8x32toF32(_mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src+i)), vOffset), dst+i, vScale);
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(SoapySDR::U8toS8(src[i])) * scale;
+    }
+}
+
+// F32 > S8
+static inline SOAPY_SDR_TARGET_AVX2 __m256i avx2F32x32toS8(const float *src, const __m256 vScale)
+{
+  const __m256 vMax = _mm256_set1_ps(127.0f);
+  const __m256 vMin = _mm256_set1_ps(-128.0f);
+  const __m256i a = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src+0), vScale), vMin), vMax));
+  const __m256i b = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src+8), vScale), vMin), vMax));
+  const __m256i c = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src+16), vScale), vMin), vMax));
+  const __m256i d = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src+24), vScale), vMin), vMax));
+  const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+  //packs operates per 128-bit lane, restore the sample order afterwards
+  return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toS8Parts(const float *src, int8_t *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+32 <= numParts; i += 32)
+    {
+      _mm256_storeu_si256((__m256i *)(dst+i), avx2F32x32toS8(src+i, vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF32toS8(src[i] * scale);
+    }
+}
+
+// F32 > U8
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toU8Parts(const float *src, uint8_t *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+  const __m256i vOffset = _mm256_set1_epi8(int8_t(SoapySDR::U8_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+32 <= numParts; i += 32)
+    {
+      _mm256_storeu_si256((__m256i *)(dst+i), _mm256_xor_si256(avx2F32x32toS8(src+i, vScale), vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::S8toU8(clampF32toS8(src[i] * scale));
+    }
+}
+
+// Clamps for the 32-bit integer and 64-bit float kernels.
+// The largest float below 2^31 is 2147483520, so 2^31 and beyond saturate to INT32_MAX
+// as in SoapySDR::F32toS32().
+
+static inline int32_t clampF32toS32(const float from)
+{
+  if (from >= 2147483648.0f) return 2147483647;
+  if (from <= -2147483648.0f) return int32_t(-2147483647-1);
+  return int32_t(from);
+}
+
+static inline int32_t clampF64toS32(const double from)
+{
+  if (from >= 2147483647.0) return 2147483647;
+  if (from <= -2147483648.0) return int32_t(-2147483647-1);
+  return int32_t(from);
+}
+
+static inline int16_t clampF64toS16(const double from)
+{
+  if (from >= 32767.0) return 32767;
+  if (from <= -32768.0) return -32768;
+  return int16_t(from);
+}
+
+// F32 > F64
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toF64Parts(const float *src, double *dst, const size_t numParts, const double scale)
+{
+  const __m256d vScale = _mm256_set1_pd(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      _mm256_storeu_pd(dst+i+0, _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(src+i+0)), vScale));
+      _mm256_storeu_pd(dst+i+4, _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(src+i+4)), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = double(src[i]) * scale;
+    }
+}
+
+// F64 > F32
+static SOAPY_SDR_TARGET_AVX2 void avx2F64toF32Parts(const double *src, float *dst, const size_t numParts, const double scale)
+{
+  const __m256d vScale = _mm256_set1_pd(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      _mm_storeu_ps(dst+i+0, _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(src+i+0), vScale)));
+      _mm_storeu_ps(dst+i+4, _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(src+i+4), vScale)));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(src[i] * scale);
+    }
+}
+
+// S16 > F64
+static SOAPY_SDR_TARGET_AVX2 void avx2S16toF64Parts(const int16_t *src, double *dst, const size_t numParts, const double scale)
+{
+  const __m256d vScale = _mm256_set1_pd(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m256i in = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(src+i)));
+      _mm256_storeu_pd(dst+i+0, _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(in)), vScale));
+      _mm256_storeu_pd(dst+i+4, _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(in, 1)), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = double(src[i]) * scale;
+    }
+}
+
+// F64 > S16
+static inline SOAPY_SDR_TARGET_AVX2 __m128i avx2F64x4toS32(const double *src, const __m256d vScale, const __m256d vMin, const __m256d vMax)
+{
+  return _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(_mm256_mul_pd(_mm256_loadu_pd(src), vScale), vMin), vMax));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F64toS16Parts(const double *src, int16_t *dst, const size_t numParts, const double scale)
+{
+  const __m256d vScale = _mm256_set1_pd(scale);
+  const __m256d vMax = _mm256_set1_pd(32767.0);
+  const __m256d vMin = _mm256_set1_pd(-32768.0);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128i a = avx2F64x4toS32(src+i+0, vScale, vMin, vMax);
+      const __m128i b = avx2F64x4toS32(src+i+4, vScale, vMin, vMax);
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_packs_epi32(a, b));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF64toS16(src[i] * scale);
+    }
+}
+
+// The 32-bit integer kernels take the offset (0 or U32_ZERO_OFFSET) applied to each part.
+
+// S32 > F32
+static SOAPY_SDR_TARGET_AVX2 void avx2S32toF32Parts(const uint32_t *src, float *dst, const size_t numParts, const uint32_t offset, const float scale)
+{
+  const __m256i vOffset = _mm256_set1_epi32(int32_t(offset));
+  const __m256 vScale = _mm256_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m256i in = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src+i)), vOffset);
+      _mm256_storeu_ps(dst+i, _mm256_mul_ps(_mm256_cvtepi32_ps(in), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(int32_t(src[i] ^ offset)) * scale;
+    }
+}
+
+// F32 > S32
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toS32Parts(const float *src, uint32_t *dst, const size_t numParts, const uint32_t offset, const float scale)
+{
+  const __m256i vOffset = _mm256_set1_epi32(int32_t(offset));
+  const __m256 vScale = _mm256_set1_ps(scale);
+  const __m256 vMin = _mm256_set1_ps(-2147483648.0f);
+  const __m256 vLimit = _mm256_set1_ps(2147483648.0f);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      //the conversion returns 0x80000000 from 2^31, flipping its bits saturates to 0x7fffffff
+      const __m256 in = _mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src+i), vScale), vMin);
+      const __m256i over = _mm256_castps_si256(_mm256_cmp_ps(in, vLimit, _CMP_GE_OQ));
+      const __m256i out = _mm256_xor_si256(_mm256_cvttps_epi32(in), over);
+      _mm256_storeu_si256((__m256i *)(dst+i), _mm256_xor_si256(out, vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = uint32_t(clampF32toS32(src[i] * scale)) ^ offset;
+    }
+}
+
+// S32 > F64
+static SOAPY_SDR_TARGET_AVX2 void avx2S32toF64Parts(const uint32_t *src, double *dst, const size_t numParts, const uint32_t offset, const double scale)
+{
+  const __m128i vOffset = _mm_set1_epi32(int32_t(offset));
+  const __m256d vScale = _mm256_set1_pd(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128i a = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i+0)), vOffset);
+      const __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i+4)), vOffset);
+      _mm256_storeu_pd(dst+i+0, _mm256_mul_pd(_mm256_cvtepi32_pd(a), vScale));
+      _mm256_storeu_pd(dst+i+4, _mm256_mul_pd(_mm256_cvtepi32_pd(b), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = double(int32_t(src[i] ^ offset)) * scale;
+    }
+}
+
+// F64 > S32
+static SOAPY_SDR_TARGET_AVX2 void avx2F64toS32Parts(const double *src, uint32_t *dst, const size_t numParts, const uint32_t offset, const double scale)
+{
+  const __m128i vOffset = _mm_set1_epi32(int32_t(offset));
+  const __m256d vScale = _mm256_set1_pd(scale);
+  const __m256d vMax = _mm256_set1_pd(2147483647.0);
+  const __m256d vMin = _mm256_set1_pd(-2147483648.0);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      _mm_storeu_si128((__m128i *)(dst+i+0), _mm_xor_si128(avx2F64x4toS32(src+i+0, vScale, vMin, vMax), vOffset));
+      _mm_storeu_si128((__m128i *)(dst+i+4), _mm_xor_si128(avx2F64x4toS32(src+i+4, vScale, vMin, vMax), vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = uint32_t(clampF64toS32(src[i] * scale)) ^ offset;
+    }
+}
+
+// F16C is part of the AVX2 tier, see ConverterISA.hpp
+
+// F16 > F32
+static SOAPY_SDR_TARGET_AVX2 void avx2F16toF32Parts(const uint16_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m256 lo = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src+i+0)));
+      const __m256 hi = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src+i+8)));
+      _mm256_storeu_ps(dst+i+0, _mm256_mul_ps(lo, vScale));
+      _mm256_storeu_ps(dst+i+8, _mm256_mul_ps(hi, vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::F16toF32(src[i]) * scale;
+    }
+}
+
+// F32 > F16
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toF16Parts(const float *src, uint16_t *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m256 lo = _mm256_mul_ps(_mm256_loadu_ps(src+i+0), vScale);
+      const __m256 hi = _mm256_mul_ps(_mm256_loadu_ps(src+i+8), vScale);
+      _mm_storeu_si128((__m128i *)(dst+i+0), _mm256_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT));
+      _mm_storeu_si128((__m128i *)(dst+i+8), _mm256_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::F32toF16(src[i] * scale);
+    }
+}
+
+// F16 > S16
+static SOAPY_SDR_TARGET_AVX2 void avx2F16toS16Parts(const uint16_t *src, int16_t *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+  const __m256 vMax = _mm256_set1_ps(32767.0f);
+  const __m256 vMin = _mm256_set1_ps(-32768.0f);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m256 lo = _mm256_mul_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src+i+0))), vScale);
+      const __m256 hi = _mm256_mul_ps(_mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src+i+8))), vScale);
+      const __m256i ilo = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(lo, vMin), vMax));
+      const __m256i ihi = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(hi, vMin), vMax));
+      const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(ilo, ihi), _MM_SHUFFLE(3, 1, 2, 0));
+      _mm256_storeu_si256((__m256i *)(dst+i), packed);
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF32toS16(SoapySDR::F16toF32(src[i]) * scale);
+    }
+}
+
+// S16 > F16
+static SOAPY_SDR_TARGET_AVX2 void avx2S16toF16Parts(const int16_t *src, uint16_t *dst, const size_t numParts, const float scale)
+{
+  const __m256 vScale = _mm256_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(src+i+0)));
+      const __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(src+i+8)));
+      _mm_storeu_si128((__m128i *)(dst+i+0), _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtepi32_ps(lo), vScale), _MM_FROUND_TO_NEAREST_INT));
+      _mm_storeu_si128((__m128i *)(dst+i+8), _mm256_cvtps_ph(_mm256_mul_ps(_mm256_cvtepi32_ps(hi), vScale), _MM_FROUND_TO_NEAREST_INT));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::F32toF16(float(src[i]) * scale);
+    }
+}
+
+// ********************************
+// Converter Functions
+
+// F32 <> S16
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F32toS16Parts((const float *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2S16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2S16toF32Parts((const int16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// F32 <> U16
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F32toU16Parts((const float *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2U16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2U16toF32Parts((const uint16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// CF32 <> CS16
+static SOAPY_SDR_TARGET_AVX2 void avx2CF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F32toS16Parts((const float *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2S16toF32Parts((const int16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// CF32 <> CU16
+static SOAPY_SDR_TARGET_AVX2 void avx2CF32toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F32toU16Parts((const float *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CU16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2U16toF32Parts((const uint16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// F32 <> S8
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F32toS8Parts((const float *)srcBuff, (int8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2S8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2S8toF32Parts((const int8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// CF32 <> CS8
+static SOAPY_SDR_TARGET_AVX2 void avx2CF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F32toS8Parts((const float *)srcBuff, (int8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2S8toF32Parts((const int8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// F32 <> U8
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F32toU8Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2U8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2U8toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// CF32 <> CU8
+static SOAPY_SDR_TARGET_AVX2 void avx2CF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F32toU8Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2U8toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// F32 <> F64
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F32toF64Parts((const float *)srcBuff, (double *)dstBuff, numElems*elemDepth, scaler);
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F64toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F64toF32Parts((const double *)srcBuff, (float *)dstBuff, numElems*elemDepth, scaler);
+}
+
+// S16 <> F64
+static SOAPY_SDR_TARGET_AVX2 void avx2S16toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2S16toF64Parts((const int16_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, scaler/SoapySDR::S16_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F64toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F64toS16Parts((const double *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, scaler*SoapySDR::S16_FULL_SCALE);
+}
+
+// S32 <> F32
+static SOAPY_SDR_TARGET_AVX2 void avx2S32toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2S32toF32Parts((const uint32_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, 0, float(scaler/SoapySDR::S32_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F32toS32Parts((const float *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, 0, float(scaler*SoapySDR::S32_FULL_SCALE));
+}
+
+// U32 <> F32
+static SOAPY_SDR_TARGET_AVX2 void avx2U32toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2S32toF32Parts((const uint32_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, float(scaler/SoapySDR::S32_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F32toS32Parts((const float *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, float(scaler*SoapySDR::S32_FULL_SCALE));
+}
+
+// S32 <> F64
+static SOAPY_SDR_TARGET_AVX2 void avx2S32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2S32toF64Parts((const uint32_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, 0, scaler/SoapySDR::S32_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F64toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F64toS32Parts((const double *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, 0, scaler*SoapySDR::S32_FULL_SCALE);
+}
+
+// U32 <> F64
+static SOAPY_SDR_TARGET_AVX2 void avx2U32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2S32toF64Parts((const uint32_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, scaler/SoapySDR::S32_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F64toU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F64toS32Parts((const double *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, scaler*SoapySDR::S32_FULL_SCALE);
+}
+
+// CF32 <> CF64
+static SOAPY_SDR_TARGET_AVX2 void avx2CF32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F32toF64Parts((const float *)srcBuff, (double *)dstBuff, numElems*elemDepth, scaler);
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CF64toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F64toF32Parts((const double *)srcBuff, (float *)dstBuff, numElems*elemDepth, scaler);
+}
+
+// CS16 <> CF64
+static SOAPY_SDR_TARGET_AVX2 void avx2CS16toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2S16toF64Parts((const int16_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, scaler/SoapySDR::S16_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CF64toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F64toS16Parts((const double *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, scaler*SoapySDR::S16_FULL_SCALE);
+}
+
+// CS32 <> CF32
+static SOAPY_SDR_TARGET_AVX2 void avx2CS32toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2S32toF32Parts((const uint32_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, 0, float(scaler/SoapySDR::S32_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CF32toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F32toS32Parts((const float *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, 0, float(scaler*SoapySDR::S32_FULL_SCALE));
+}
+
+// CU32 <> CF32
+static SOAPY_SDR_TARGET_AVX2 void avx2CU32toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2S32toF32Parts((const uint32_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, float(scaler/SoapySDR::S32_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CF32toCU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F32toS32Parts((const float *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, float(scaler*SoapySDR::S32_FULL_SCALE));
+}
+
+// CS32 <> CF64
+static SOAPY_SDR_TARGET_AVX2 void avx2CS32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2S32toF64Parts((const uint32_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, 0, scaler/SoapySDR::S32_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CF64toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F64toS32Parts((const double *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, 0, scaler*SoapySDR::S32_FULL_SCALE);
+}
+
+// CU32 <> CF64
+static SOAPY_SDR_TARGET_AVX2 void avx2CU32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2S32toF64Parts((const uint32_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, scaler/SoapySDR::S32_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CF64toCU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F64toS32Parts((const double *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, scaler*SoapySDR::S32_FULL_SCALE);
+}
+
+// F16 <> F32
+static SOAPY_SDR_TARGET_AVX2 void avx2F16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F16toF32Parts((const uint16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2F32toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F32toF16Parts((const float *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler));
+}
+
+// F16 <> S16
+static SOAPY_SDR_TARGET_AVX2 void avx2F16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2F16toS16Parts((const uint16_t *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2S16toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx2S16toF16Parts((const int16_t *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// CF16 <> CF32
+static SOAPY_SDR_TARGET_AVX2 void avx2CF16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F16toF32Parts((const uint16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CF32toCF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F32toF16Parts((const float *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler));
+}
+
+// CF16 <> CS16
+static SOAPY_SDR_TARGET_AVX2 void avx2CF16toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2F16toS16Parts((const uint16_t *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX2 void avx2CS16toCF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2S16toF16Parts((const int16_t *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+#endif //SOAPY_SDR_CONVERTER_X86
+
+/*!
+ * Register the AVX2 converters at VECTORIZED priority.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadAVX2Converters(void)
+{
+#ifdef SOAPY_SDR_CONVERTER_X86
+    static SoapySDR::ConverterRegistry registerAVX2F32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F32toS16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2S16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2S16toF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F32toU16(SOAPY_SDR_F32, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F32toU16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2U16toF32(SOAPY_SDR_U16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2U16toF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCS16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS16toCF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF32toCU16(SOAPY_SDR_CF32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCU16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CU16toCF32(SOAPY_SDR_CU16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CU16toCF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F32toS8, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2S8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2S8toF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F32toU8, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2U8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2U8toF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCS8, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS8toCF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCU8, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CU8toCF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F32toF64(SOAPY_SDR_F32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F32toF64, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F64toF32(SOAPY_SDR_F64, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F64toF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2S16toF64(SOAPY_SDR_S16, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, &avx2S16toF64, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F64toS16(SOAPY_SDR_F64, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F64toS16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2S32toF32(SOAPY_SDR_S32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2S32toF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F32toS32(SOAPY_SDR_F32, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F32toS32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2U32toF32(SOAPY_SDR_U32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2U32toF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F32toU32(SOAPY_SDR_F32, SOAPY_SDR_U32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F32toU32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2S32toF64(SOAPY_SDR_S32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, &avx2S32toF64, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F64toS32(SOAPY_SDR_F64, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F64toS32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2U32toF64(SOAPY_SDR_U32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, &avx2U32toF64, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F64toU32(SOAPY_SDR_F64, SOAPY_SDR_U32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F64toU32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF32toCF64(SOAPY_SDR_CF32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCF64, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF64toCF32(SOAPY_SDR_CF64, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF64toCF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CS16toCF64(SOAPY_SDR_CS16, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS16toCF64, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF64toCS16(SOAPY_SDR_CF64, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF64toCS16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CS32toCF32(SOAPY_SDR_CS32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS32toCF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF32toCS32(SOAPY_SDR_CF32, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCS32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CU32toCF32(SOAPY_SDR_CU32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CU32toCF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF32toCU32(SOAPY_SDR_CF32, SOAPY_SDR_CU32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCU32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CS32toCF64(SOAPY_SDR_CS32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS32toCF64, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF64toCS32(SOAPY_SDR_CF64, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF64toCS32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CU32toCF64(SOAPY_SDR_CU32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CU32toCF64, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF64toCU32(SOAPY_SDR_CF64, SOAPY_SDR_CU32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF64toCU32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F16toF32(SOAPY_SDR_F16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F16toF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F32toF16(SOAPY_SDR_F32, SOAPY_SDR_F16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F32toF16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2F16toS16(SOAPY_SDR_F16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2F16toS16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2S16toF16(SOAPY_SDR_S16, SOAPY_SDR_F16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2S16toF16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF16toCF32(SOAPY_SDR_CF16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF16toCF32, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF32toCF16(SOAPY_SDR_CF32, SOAPY_SDR_CF16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF32toCF16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CF16toCS16(SOAPY_SDR_CF16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CF16toCS16, SoapySDR::ConverterRegistry::ISA_AVX2);
+    static SoapySDR::ConverterRegistry registerAVX2CS16toCF16(SOAPY_SDR_CS16, SOAPY_SDR_CF16, SoapySDR::ConverterRegistry::VECTORIZED, &avx2CS16toCF16, SoapySDR::ConverterRegistry::ISA_AVX2);
+#endif //SOAPY_SDR_CONVERTER_X86
+}
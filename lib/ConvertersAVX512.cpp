@@ -0,0 +1,333 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterISA.hpp"
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+#include <immintrin.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+//false positive from the _mm512_undefined_*() helpers in the GCC headers
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// ********************************
+// AVX-512 Kernels
+//
+// Each kernel operates on a flat array of parts (numElems*elemDepth),
+// so the real and complex converters share the same loop body.
+// Loads and stores are unaligned and the remainder is handled in scalar.
+// The narrowing direction uses the saturating down-converts,
+// which keep the sample order unlike the 256-bit packs.
+
+static inline int16_t clampF32toS16(const float from)
+{
+  if (from >= 32767.0f) return 32767;
+  if (from <= -32768.0f) return -32768;
+  return int16_t(from);
+}
+
+static inline int8_t clampF32toS8(const float from)
+{
+  if (from >= 127.0f) return 127;
+  if (from <= -128.0f) return -128;
+  return int8_t(from);
+}
+
+// S16 > F32
+static SOAPY_SDR_TARGET_AVX512 void avx512S16toF32Parts(const int16_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m512 vScale = _mm512_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m512i in = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)(src+i)));
+      _mm512_storeu_ps(dst+i, _mm512_mul_ps(_mm512_cvtepi32_ps(in), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(src[i]) * scale;
+    }
+}
+
+// U16 > F32
+static SOAPY_SDR_TARGET_AVX512 void avx512U16toF32Parts(const uint16_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m512 vScale = _mm512_set1_ps(scale);
+  const __m256i vOffset = _mm256_set1_epi16(int16_t(SoapySDR::U16_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m512i in = _mm512_cvtepi16_epi32(_mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(src+i)), vOffset));
+      _mm512_storeu_ps(dst+i, _mm512_mul_ps(_mm512_cvtepi32_ps(in), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(SoapySDR::U16toS16(src[i])) * scale;
+    }
+}
+
+// F32 > S16
+static inline SOAPY_SDR_TARGET_AVX512 __m256i avx512F32x16toS16(const float *src, const __m512 vScale)
+{
+  const __m512 vMax = _mm512_set1_ps(32767.0f);
+  const __m512 vMin = _mm512_set1_ps(-32768.0f);
+  const __m512 in = _mm512_mul_ps(_mm512_loadu_ps(src), vScale);
+  return _mm512_cvtsepi32_epi16(_mm512_cvttps_epi32(_mm512_min_ps(_mm512_max_ps(in, vMin), vMax)));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512F32toS16Parts(const float *src, int16_t *dst, const size_t numParts, const float scale)
+{
+  const __m512 vScale = _mm512_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      _mm256_storeu_si256((__m256i *)(dst+i), avx512F32x16toS16(src+i, vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF32toS16(src[i] * scale);
+    }
+}
+
+// F32 > U16
+static SOAPY_SDR_TARGET_AVX512 void avx512F32toU16Parts(const float *src, uint16_t *dst, const size_t numParts, const float scale)
+{
+  const __m512 vScale = _mm512_set1_ps(scale);
+  const __m256i vOffset = _mm256_set1_epi16(int16_t(SoapySDR::U16_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      _mm256_storeu_si256((__m256i *)(dst+i), _mm256_xor_si256(avx512F32x16toS16(src+i, vScale), vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::S16toU16(clampF32toS16(src[i] * scale));
+    }
+}
+
+// S8 > F32
+static SOAPY_SDR_TARGET_AVX512 void avx512S8toF32Parts(const int8_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m512 vScale = _mm512_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m512i in = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *)(src+i)));
+      _mm512_storeu_ps(dst+i, _mm512_mul_ps(_mm512_cvtepi32_ps(in), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(src[i]) * scale;
+    }
+}
+
+// U8 > F32
+static SOAPY_SDR_TARGET_AVX512 void avx512U8toF32Parts(const uint8_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m512 vScale = _mm512_set1_ps(scale);
+  const __m128i vOffset = _mm_set1_epi8(int8_t(SoapySDR::U8_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      const __m512i in = _mm512_cvtepi8_epi32(_mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i)), vOffset));
+      _mm512_storeu_ps(dst+i, _mm512_mul_ps(_mm512_cvtepi32_ps(in), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(SoapySDR::U8toS8(src[i])) * scale;
+    }
+}
+
+// F32 > S8
+static inline SOAPY_SDR_TARGET_AVX512 __m128i avx512F32x16toS8(const float *src, const __m512 vScale)
+{
+  const __m512 vMax = _mm512_set1_ps(127.0f);
+  const __m512 vMin = _mm512_set1_ps(-128.0f);
+  const __m512 in = _mm512_mul_ps(_mm512_loadu_ps(src), vScale);
+  return _mm512_cvtsepi32_epi8(_mm512_cvttps_epi32(_mm512_min_ps(_mm512_max_ps(in, vMin), vMax)));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512F32toS8Parts(const float *src, int8_t *dst, const size_t numParts, const float scale)
+{
+  const __m512 vScale = _mm512_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      _mm_storeu_si128((__m128i *)(dst+i), avx512F32x16toS8(src+i, vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF32toS8(src[i] * scale);
+    }
+}
+
+// F32 > U8
+static SOAPY_SDR_TARGET_AVX512 void avx512F32toU8Parts(const float *src, uint8_t *dst, const size_t numParts, const float scale)
+{
+  const __m512 vScale = _mm512_set1_ps(scale);
+  const __m128i vOffset = _mm_set1_epi8(int8_t(SoapySDR::U8_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(avx512F32x16toS8(src+i, vScale), vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::S8toU8(clampF32toS8(src[i] * scale));
+    }
+}
+
+// ********************************
+// Converter Functions
+
+// F32 <> S16
+static SOAPY_SDR_TARGET_AVX512 void avx512F32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx512F32toS16Parts((const float *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512S16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx512S16toF32Parts((const int16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// F32 <> U16
+static SOAPY_SDR_TARGET_AVX512 void avx512F32toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx512F32toU16Parts((const float *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512U16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx512U16toF32Parts((const uint16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// CF32 <> CS16
+static SOAPY_SDR_TARGET_AVX512 void avx512CF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx512F32toS16Parts((const float *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx512S16toF32Parts((const int16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// CF32 <> CU16
+static SOAPY_SDR_TARGET_AVX512 void avx512CF32toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx512F32toU16Parts((const float *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512CU16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx512U16toF32Parts((const uint16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// F32 <> S8
+static SOAPY_SDR_TARGET_AVX512 void avx512F32toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx512F32toS8Parts((const float *)srcBuff, (int8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512S8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx512S8toF32Parts((const int8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// CF32 <> CS8
+static SOAPY_SDR_TARGET_AVX512 void avx512CF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx512F32toS8Parts((const float *)srcBuff, (int8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx512S8toF32Parts((const int8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// F32 <> U8
+static SOAPY_SDR_TARGET_AVX512 void avx512F32toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx512F32toU8Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512U8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  avx512U8toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// CF32 <> CU8
+static SOAPY_SDR_TARGET_AVX512 void avx512CF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx512F32toU8Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_AVX512 void avx512CU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx512U8toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+#endif //SOAPY_SDR_CONVERTER_X86
+
+/*!
+ * Register the AVX-512 converters at VECTORIZED priority.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadAVX512Converters(void)
+{
+#ifdef SOAPY_SDR_CONVERTER_X86
+    static SoapySDR::ConverterRegistry registerAVX512F32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, &avx512F32toS16, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512S16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx512S16toF32, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512F32toU16(SOAPY_SDR_F32, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::VECTORIZED, &avx512F32toU16, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512U16toF32(SOAPY_SDR_U16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx512U16toF32, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512CF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &avx512CF32toCS16, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512CS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx512CS16toCF32, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512CF32toCU16(SOAPY_SDR_CF32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::VECTORIZED, &avx512CF32toCU16, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512CU16toCF32(SOAPY_SDR_CU16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx512CU16toCF32, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512F32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::VECTORIZED, &avx512F32toS8, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512S8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx512S8toF32, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512F32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::VECTORIZED, &avx512F32toU8, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512U8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &avx512U8toF32, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512CF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &avx512CF32toCS8, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512CS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx512CS8toCF32, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512CF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::VECTORIZED, &avx512CF32toCU8, SoapySDR::ConverterRegistry::ISA_AVX512);
+    static SoapySDR::ConverterRegistry registerAVX512CU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &avx512CU8toCF32, SoapySDR::ConverterRegistry::ISA_AVX512);
+#endif //SOAPY_SDR_CONVERTER_X86
+}
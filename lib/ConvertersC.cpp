@@ -11,9 +11,15 @@
 
 extern "C" {
 
+static_assert(int(SoapySDR::ConverterRegistry::DITHERED) == int(SOAPY_SDR_CONVERTER_DITHERED), "DITHERED");
 static_assert(int(SoapySDR::ConverterRegistry::GENERIC) == int(SOAPY_SDR_CONVERTER_GENERIC), "GENERIC");
 static_assert(int(SoapySDR::ConverterRegistry::VECTORIZED) == int(SOAPY_SDR_CONVERTER_VECTORIZED), "VECTORIZED");
 static_assert(int(SoapySDR::ConverterRegistry::CUSTOM) == int(SOAPY_SDR_CONVERTER_CUSTOM), "CUSTOM");
+static_assert(int(SoapySDR::ConverterRegistry::ISA_GENERIC) == int(SOAPY_SDR_CONVERTER_ISA_GENERIC), "ISA_GENERIC");
+static_assert(int(SoapySDR::ConverterRegistry::ISA_SSE2) == int(SOAPY_SDR_CONVERTER_ISA_SSE2), "ISA_SSE2");
+static_assert(int(SoapySDR::ConverterRegistry::ISA_SSE41) == int(SOAPY_SDR_CONVERTER_ISA_SSE41), "ISA_SSE41");
+static_assert(int(SoapySDR::ConverterRegistry::ISA_AVX2) == int(SOAPY_SDR_CONVERTER_ISA_AVX2), "ISA_AVX2");
+static_assert(int(SoapySDR::ConverterRegistry::ISA_AVX512) == int(SOAPY_SDR_CONVERTER_ISA_AVX512), "ISA_AVX512");
 static_assert(std::is_same<SoapySDR::ConverterRegistry::ConverterFunction, SoapySDRConverterFunction>::value, "ConverterFunction");
 
 char **SoapySDRConverter_listTargetFormats(const char *sourceFormat, size_t *length)
@@ -78,4 +84,138 @@ char **SoapySDRConverter_listAvailableSourceFormats(size_t *length)
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+SoapySDRConverterInstructionSet SoapySDRConverter_getInstructionSet(void)
+{
+    return static_cast<SoapySDRConverterInstructionSet>(SoapySDR::ConverterRegistry::getInstructionSet());
+}
+
+SoapySDRConverterInstructionSet *SoapySDRConverter_listInstructionSets(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, size_t *length)
+{
+    *length = 0;
+
+    __SOAPY_SDR_C_TRY
+    auto isasCpp = SoapySDR::ConverterRegistry::listInstructionSets(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionPriority>(priority));
+    if(!isasCpp.empty())
+    {
+        auto* isasC = callocArrayType<SoapySDRConverterInstructionSet>(isasCpp.size());
+        for(size_t i = 0; i < isasCpp.size(); ++i)
+        {
+            isasC[i] = static_cast<SoapySDRConverterInstructionSet>(isasCpp[i]);
+        }
+        *length = isasCpp.size();
+
+        return isasC;
+    }
+    else return nullptr;
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverterFunction SoapySDRConverter_getFunctionWithInstructionSet(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority, const SoapySDRConverterInstructionSet isa)
+{
+    __SOAPY_SDR_C_TRY
+    return static_cast<SoapySDRConverterFunction>(SoapySDR::ConverterRegistry::getFunction(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionPriority>(priority), static_cast<SoapySDR::ConverterRegistry::InstructionSet>(isa)));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+int SoapySDRConverter_tunePriority(const char *sourceFormat, const char *targetFormat, const size_t numElems, SoapySDRConverterFunctionPriority *priority)
+{
+    __SOAPY_SDR_C_TRY
+    *priority = static_cast<SoapySDRConverterFunctionPriority>(SoapySDR::ConverterRegistry::tunePriority(sourceFormat, targetFormat, numElems));
+    __SOAPY_SDR_C_CATCH
+}
+
+SoapySDRConverter *SoapySDRConverter_make(const char *sourceFormat, const char *targetFormat)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverter *)new SoapySDR::Converter(sourceFormat, targetFormat);
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverter *SoapySDRConverter_makeWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverter *)new SoapySDR::Converter(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionPriority>(priority));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRConverter *SoapySDRConverter_makeWithArgs(const char *sourceFormat, const char *targetFormat, const SoapySDRKwargs *args)
+{
+    __SOAPY_SDR_C_TRY
+    return (SoapySDRConverter *)new SoapySDR::Converter(sourceFormat, targetFormat, toKwargs(args));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+void SoapySDRConverter_unmake(SoapySDRConverter *converter)
+{
+    delete (SoapySDR::Converter *)converter;
+}
+
+int SoapySDRConverter_convert(const SoapySDRConverter *converter, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    ((const SoapySDR::Converter *)converter)->convert(srcBuff, dstBuff, numElems, scaler);
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRConverter_convertBatch(const SoapySDRConverter *converter, const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double *scalers)
+{
+    __SOAPY_SDR_C_TRY
+    ((const SoapySDR::Converter *)converter)->convertBatch(srcBuffs, dstBuffs, numChans, numElems, scalers);
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRConverter_convertParallel(const SoapySDRConverter *converter, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler, const size_t numThreads)
+{
+    __SOAPY_SDR_C_TRY
+    ((const SoapySDR::Converter *)converter)->convertParallel(srcBuff, dstBuff, numElems, scaler, numThreads);
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRConverter_convertComplex(const SoapySDRConverter *converter, const void *srcBuff, void *dstBuff, const size_t numElems, const double scalerReal, const double scalerImag)
+{
+    __SOAPY_SDR_C_TRY
+    ((const SoapySDR::Converter *)converter)->convert(srcBuff, dstBuff, numElems, std::complex<double>(scalerReal, scalerImag));
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRConverter_convertBatchComplex(const SoapySDRConverter *converter, const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double *scalers)
+{
+    __SOAPY_SDR_C_TRY
+    static_assert(sizeof(std::complex<double>) == 2*sizeof(double), "complex<double> layout");
+    ((const SoapySDR::Converter *)converter)->convertBatch(srcBuffs, dstBuffs, numChans, numElems, (const std::complex<double> *)scalers);
+    __SOAPY_SDR_C_CATCH
+}
+
+int SoapySDRConverter_reset(SoapySDRConverter *converter)
+{
+    __SOAPY_SDR_C_TRY
+    ((SoapySDR::Converter *)converter)->reset();
+    __SOAPY_SDR_C_CATCH
+}
+
+SoapySDRConverterFunction SoapySDRConverter_getHandleFunction(const SoapySDRConverter *converter)
+{
+    return ((const SoapySDR::Converter *)converter)->getFunction();
+}
+
+size_t SoapySDRConverter_getSourceElementSize(const SoapySDRConverter *converter)
+{
+    return ((const SoapySDR::Converter *)converter)->getSourceElementSize();
+}
+
+size_t SoapySDRConverter_getTargetElementSize(const SoapySDRConverter *converter)
+{
+    return ((const SoapySDR::Converter *)converter)->getTargetElementSize();
+}
+
+size_t SoapySDRConverter_getSourceElementDepth(const SoapySDRConverter *converter)
+{
+    return ((const SoapySDR::Converter *)converter)->getSourceElementDepth();
+}
+
+size_t SoapySDRConverter_getTargetElementDepth(const SoapySDRConverter *converter)
+{
+    return ((const SoapySDR::Converter *)converter)->getTargetElementDepth();
+}
+
 }
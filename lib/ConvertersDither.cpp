@@ -0,0 +1,277 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterISA.hpp"
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Types.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+#include <emmintrin.h>
+#endif
+
+// ********************************
+// Dithered Converters
+//
+// Narrow CF32 with triangular (TPDF) dither of +/-1 LSB added before
+// rounding, which decorrelates the quantization error from the signal
+// and turns the spurs into a flat noise floor.
+// Optional first-order noise shaping feeds the quantization error of
+// each part back into the next sample, moving the noise away from DC
+// toward the edges of the band.
+//
+// Each context keeps 4 xorshift32 generators, one per lane;
+// part i of a buffer uses lane i%4 in both the generic and SSE2 kernels.
+// A uniform pair is taken from the two halves of each 32-bit draw.
+//
+// Converter arguments:
+//   noiseShaping: "true" for first-order noise shaping (default false)
+//   seed: the generator seed (default unique per context)
+
+//elements per chunk, the staging buffer stays in the L1 cache
+static const size_t DITHER_CHUNK_ELEMS = 2048;
+
+struct DitherContext;
+
+typedef void (*DitherKernel)(DitherContext &ctx, const float *src, int16_t *dst, const size_t numElems, const float scale, const int16_t min, const int16_t max);
+
+struct DitherContext
+{
+  DitherKernel kernel;
+  uint32_t seed;
+  uint32_t rng[4];
+  float error[2]; //noise shaping error feedback for I and Q
+};
+
+static inline uint32_t xorshift32(uint32_t &state)
+{
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+static inline float tpdf(const uint32_t r)
+{
+  return float(int32_t(r & 0xffff) - int32_t(r >> 16))*(1.0f/65536);
+}
+
+static inline int16_t clampDither(const float from, const int16_t min, const int16_t max)
+{
+  return int16_t(std::max<float>(min, std::min<float>(max, from)));
+}
+
+static void genericDither(DitherContext &ctx, const float *src, int16_t *dst, const size_t numElems, const float scale, const int16_t min, const int16_t max)
+{
+  for (size_t i = 0; i < numElems*2; i++)
+    {
+      const float d = tpdf(xorshift32(ctx.rng[i & 3]));
+      dst[i] = clampDither(std::nearbyint(src[i]*scale + d), min, max);
+    }
+}
+
+static void genericDitherShaped(DitherContext &ctx, const float *src, int16_t *dst, const size_t numElems, const float scale, const int16_t min, const int16_t max)
+{
+  for (size_t i = 0; i < numElems*2; i++)
+    {
+      const float d = tpdf(xorshift32(ctx.rng[i & 3]));
+      const float v = src[i]*scale - ctx.error[i & 1];
+      const float q = std::nearbyint(v + d);
+      //the error is taken before clipping, so a clipped sample can not destabilize the loop
+      ctx.error[i & 1] = q - v;
+      dst[i] = clampDither(q, min, max);
+    }
+}
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+static SOAPY_SDR_TARGET_SSE2 inline __m128 sse2Tpdf(__m128i &state)
+{
+  state = _mm_xor_si128(state, _mm_slli_epi32(state, 13));
+  state = _mm_xor_si128(state, _mm_srli_epi32(state, 17));
+  state = _mm_xor_si128(state, _mm_slli_epi32(state, 5));
+  const __m128i lo = _mm_and_si128(state, _mm_set1_epi32(0xffff));
+  const __m128i hi = _mm_srli_epi32(state, 16);
+  return _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(lo, hi)), _mm_set1_ps(1.0f/65536));
+}
+
+//round to nearest in float: beyond 2^23 a float is already an integer, and the conversion could overflow
+static SOAPY_SDR_TARGET_SSE2 inline __m128 sse2Round(const __m128 x)
+{
+  const __m128 magnitude = _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+  const __m128 integral = _mm_cmpge_ps(magnitude, _mm_set1_ps(8388608.0f));
+  const __m128 rounded = _mm_cvtepi32_ps(_mm_cvtps_epi32(x));
+  return _mm_or_ps(_mm_and_ps(integral, x), _mm_andnot_ps(integral, rounded));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2Dither(DitherContext &ctx, const float *src, int16_t *dst, const size_t numElems, const float scale, const int16_t min, const int16_t max)
+{
+  const size_t numParts = numElems*2;
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMin = _mm_set1_ps(min);
+  const __m128 vMax = _mm_set1_ps(max);
+  __m128i state = _mm_loadu_si128((const __m128i *)ctx.rng);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      //clamp in float, the conversion overflows beyond 32 bits; then round to nearest with the default rounding mode
+      const __m128 a = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src+i+0), vScale), sse2Tpdf(state));
+      const __m128 b = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src+i+4), vScale), sse2Tpdf(state));
+      const __m128i ia = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(a, vMin), vMax));
+      const __m128i ib = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(b, vMin), vMax));
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_packs_epi32(ia, ib));
+    }
+
+  _mm_storeu_si128((__m128i *)ctx.rng, state);
+  genericDither(ctx, src+i, dst+i, (numParts-i)/2, scale, min, max);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2DitherShaped(DitherContext &ctx, const float *src, int16_t *dst, const size_t numElems, const float scale, const int16_t min, const int16_t max)
+{
+  //the feedback is serial between elements, so each vector holds [I, Q] of one element in the low half
+  const size_t numParts = numElems*2;
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMin = _mm_set1_ps(min);
+  const __m128 vMax = _mm_set1_ps(max);
+  __m128i state = _mm_loadu_si128((const __m128i *)ctx.rng);
+  __m128 error = _mm_castpd_ps(_mm_load_sd((const double *)ctx.error));
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      const __m128 d = sse2Tpdf(state);
+      const __m128 x = _mm_mul_ps(_mm_loadu_ps(src+i), vScale);
+
+      //the error is taken before clipping, as in the generic kernel
+      const __m128 v0 = _mm_sub_ps(x, error);
+      const __m128 q0 = sse2Round(_mm_add_ps(v0, d));
+      error = _mm_sub_ps(q0, v0);
+
+      const __m128 v1 = _mm_sub_ps(_mm_movehl_ps(x, x), error);
+      const __m128 q1 = sse2Round(_mm_add_ps(v1, _mm_movehl_ps(d, d)));
+      error = _mm_sub_ps(q1, v1);
+
+      const __m128 q = _mm_movelh_ps(q0, q1);
+      const __m128i out = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(q, vMin), vMax));
+      _mm_storel_epi64((__m128i *)(dst+i), _mm_packs_epi32(out, out));
+    }
+
+  _mm_storeu_si128((__m128i *)ctx.rng, state);
+  _mm_store_sd((double *)ctx.error, _mm_castps_pd(error));
+  genericDitherShaped(ctx, src+i, dst+i, (numParts-i)/2, scale, min, max);
+}
+#endif //SOAPY_SDR_CONVERTER_X86
+
+/***********************************************************************
+ * Context
+ **********************************************************************/
+static void resetDither(void *context)
+{
+  auto &ctx = *(DitherContext *)context;
+  uint32_t x = ctx.seed;
+  for (auto &state : ctx.rng)
+    {
+      //splitmix32 spreads the seed across the lanes, a zero state would stick
+      x += 0x9e3779b9;
+      uint32_t z = x;
+      z = (z ^ (z >> 16))*0x85ebca6b;
+      z = (z ^ (z >> 13))*0xc2b2ae35;
+      z ^= z >> 16;
+      state = (z == 0)?1:z;
+    }
+  ctx.error[0] = ctx.error[1] = 0.0f;
+}
+
+static void *createDither(const SoapySDR::Kwargs &args)
+{
+  static std::atomic<uint32_t> nextSeed(1);
+
+  const auto shapingIt = args.find("noiseShaping");
+  const bool shaping = (shapingIt != args.end()) and SoapySDR::StringToSetting<bool>(shapingIt->second);
+  const auto seedIt = args.find("seed");
+
+  auto *ctx = new DitherContext();
+  ctx->seed = (seedIt != args.end())?SoapySDR::StringToSetting<uint32_t>(seedIt->second):nextSeed++;
+  ctx->kernel = shaping?&genericDitherShaped:&genericDither;
+  #ifdef SOAPY_SDR_CONVERTER_X86
+  if (SoapySDR::ConverterRegistry::getInstructionSet() >= SoapySDR::ConverterRegistry::ISA_SSE2)
+    {
+      ctx->kernel = shaping?&sse2DitherShaped:&sse2Dither;
+    }
+  #endif
+  resetDither(ctx);
+  return ctx;
+}
+
+static void destroyDither(void *context)
+{
+  delete (DitherContext *)context;
+}
+
+/***********************************************************************
+ * Converters
+ **********************************************************************/
+static void ditherCF32toCS16(void *context, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto &ctx = *(DitherContext *)context;
+  ctx.kernel(ctx, (const float *)srcBuff, (int16_t *)dstBuff, numElems, float(scaler*SoapySDR::S16_FULL_SCALE), -32768, 32767);
+}
+
+static void ditherCF32toCS12(void *context, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto &ctx = *(DitherContext *)context;
+  const float *src = (const float *)srcBuff;
+  uint8_t *dst = (uint8_t *)dstBuff;
+  int16_t staging[DITHER_CHUNK_ELEMS*2];
+
+  for (size_t offset = 0; offset < numElems; offset += DITHER_CHUNK_ELEMS)
+    {
+      const size_t n = std::min(DITHER_CHUNK_ELEMS, numElems-offset);
+      ctx.kernel(ctx, src + offset*2, staging, n, float(scaler*2048), -2048, 2047);
+      for (size_t i = 0; i < n; i++)
+        {
+          SoapySDR::CS16toCS12(int16_t(staging[i*2+0]*16), int16_t(staging[i*2+1]*16), dst + (offset+i)*3);
+        }
+    }
+}
+
+static void ditherCF32toS8Parts(DitherContext &ctx, const float *src, uint8_t *dst, const size_t numElems, const double scaler, const uint8_t offset)
+{
+  int16_t staging[DITHER_CHUNK_ELEMS*2];
+
+  for (size_t elem = 0; elem < numElems; elem += DITHER_CHUNK_ELEMS)
+    {
+      const size_t n = std::min(DITHER_CHUNK_ELEMS, numElems-elem);
+      ctx.kernel(ctx, src + elem*2, staging, n, float(scaler*SoapySDR::S8_FULL_SCALE), -128, 127);
+      for (size_t i = 0; i < n*2; i++)
+        {
+          dst[elem*2+i] = uint8_t(staging[i]) ^ offset;
+        }
+    }
+}
+
+static void ditherCF32toCS8(void *context, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  ditherCF32toS8Parts(*(DitherContext *)context, (const float *)srcBuff, (uint8_t *)dstBuff, numElems, scaler, 0);
+}
+
+static void ditherCF32toCU8(void *context, const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  ditherCF32toS8Parts(*(DitherContext *)context, (const float *)srcBuff, (uint8_t *)dstBuff, numElems, scaler, SoapySDR::U8_ZERO_OFFSET);
+}
+
+/*!
+ * Register the dithered converters at DITHERED priority.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadDitherConverters(void)
+{
+    static SoapySDR::ConverterRegistry registerDitherCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED, {&createDither, &ditherCF32toCS16, &resetDither, &destroyDither});
+    static SoapySDR::ConverterRegistry registerDitherCF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::DITHERED, {&createDither, &ditherCF32toCS12, &resetDither, &destroyDither});
+    static SoapySDR::ConverterRegistry registerDitherCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::DITHERED, {&createDither, &ditherCF32toCS8, &resetDither, &destroyDither});
+    static SoapySDR::ConverterRegistry registerDitherCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::DITHERED, {&createDither, &ditherCF32toCU8, &resetDither, &destroyDither});
+}
@@ -0,0 +1,1151 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterISA.hpp"
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+#include <emmintrin.h>
+
+// ********************************
+// SSE2 Kernels
+//
+// Each kernel operates on a flat array of parts (numElems*elemDepth),
+// so the real and complex converters share the same loop body.
+// Loads and stores are unaligned and the remainder is handled in scalar.
+
+static inline int16_t clampF32toS16(const float from)
+{
+  if (from >= 32767.0f) return 32767;
+  if (from <= -32768.0f) return -32768;
+  return int16_t(from);
+}
+
+static inline int8_t clampF32toS8(const float from)
+{
+  if (from >= 127.0f) return 127;
+  if (from <= -128.0f) return -128;
+  return int8_t(from);
+}
+
+// S16 > F32
+static SOAPY_SDR_TARGET_SSE2 void sse2S16toF32Parts(const int16_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+      const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+      const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+      _mm_storeu_ps(dst+i+0, _mm_mul_ps(_mm_cvtepi32_ps(lo), vScale));
+      _mm_storeu_ps(dst+i+4, _mm_mul_ps(_mm_cvtepi32_ps(hi), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(src[i]) * scale;
+    }
+}
+
+// U16 > F32
+static SOAPY_SDR_TARGET_SSE2 void sse2U16toF32Parts(const uint16_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128i vOffset = _mm_set1_epi16(int16_t(SoapySDR::U16_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128i in = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i)), vOffset);
+      const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+      const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+      _mm_storeu_ps(dst+i+0, _mm_mul_ps(_mm_cvtepi32_ps(lo), vScale));
+      _mm_storeu_ps(dst+i+4, _mm_mul_ps(_mm_cvtepi32_ps(hi), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(SoapySDR::U16toS16(src[i])) * scale;
+    }
+}
+
+// F32 > S16
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toS16Parts(const float *src, int16_t *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMax = _mm_set1_ps(32767.0f);
+  const __m128 vMin = _mm_set1_ps(-32768.0f);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128 a = _mm_mul_ps(_mm_loadu_ps(src+i+0), vScale);
+      const __m128 b = _mm_mul_ps(_mm_loadu_ps(src+i+4), vScale);
+      const __m128i ia = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(a, vMin), vMax));
+      const __m128i ib = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(b, vMin), vMax));
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_packs_epi32(ia, ib));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF32toS16(src[i] * scale);
+    }
+}
+
+// F32 > U16
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toU16Parts(const float *src, uint16_t *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMax = _mm_set1_ps(32767.0f);
+  const __m128 vMin = _mm_set1_ps(-32768.0f);
+  const __m128i vOffset = _mm_set1_epi16(int16_t(SoapySDR::U16_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128 a = _mm_mul_ps(_mm_loadu_ps(src+i+0), vScale);
+      const __m128 b = _mm_mul_ps(_mm_loadu_ps(src+i+4), vScale);
+      const __m128i ia = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(a, vMin), vMax));
+      const __m128i ib = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(b, vMin), vMax));
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(_mm_packs_epi32(ia, ib), vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::S16toU16(clampF32toS16(src[i] * scale));
+    }
+}
+
+// S8 > F32
+static inline SOAPY_SDR_TARGET_SSE2 void sse2S8x16toF32(const __m128i in, float *dst, const __m128 vScale)
+{
+  const __m128i lo16 = _mm_srai_epi16(_mm_unpacklo_epi8(in, in), 8);
+  const __m128i hi16 = _mm_srai_epi16(_mm_unpackhi_epi8(in, in), 8);
+  _mm_storeu_ps(dst+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(lo16, lo16), 16)), vScale));
+  _mm_storeu_ps(dst+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(lo16, lo16), 16)), vScale));
+  _mm_storeu_ps(dst+8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(hi16, hi16), 16)), vScale));
+  _mm_storeu_ps(dst+12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(hi16, hi16), 16)), vScale));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2S8toF32Parts(const int8_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      sse2S8x16toF32(_mm_loadu_si128((const __m128i *)(src+i)), dst+i, vScale);
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(src[i]) * scale;
+    }
+}
+
+// U8 > F32
+static SOAPY_SDR_TARGET_SSE2 void sse2U8toF32Parts(const uint8_t *src, float *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128i vOffset = _mm_set1_epi8(int8_t(SoapySDR::U8_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      sse2S8x16toF32(_mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i)), vOffset), dst+i, vScale);
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(SoapySDR::U8toS8(src[i])) * scale;
+    }
+}
+
+// F32 > S8
+static inline SOAPY_SDR_TARGET_SSE2 __m128i sse2F32x16toS8(const float *src, const __m128 vScale)
+{
+  const __m128 vMax = _mm_set1_ps(127.0f);
+  const __m128 vMin = _mm_set1_ps(-128.0f);
+  const __m128i a = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+0), vScale), vMin), vMax));
+  const __m128i b = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+4), vScale), vMin), vMax));
+  const __m128i c = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+8), vScale), vMin), vMax));
+  const __m128i d = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+12), vScale), vMin), vMax));
+  return _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toS8Parts(const float *src, int8_t *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      _mm_storeu_si128((__m128i *)(dst+i), sse2F32x16toS8(src+i, vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF32toS8(src[i] * scale);
+    }
+}
+
+// F32 > U8
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toU8Parts(const float *src, uint8_t *dst, const size_t numParts, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128i vOffset = _mm_set1_epi8(int8_t(SoapySDR::U8_ZERO_OFFSET));
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(sse2F32x16toS8(src+i, vScale), vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = SoapySDR::S8toU8(clampF32toS8(src[i] * scale));
+    }
+}
+
+// CS4 > CS8: 16 bytes > 32 parts
+static inline SOAPY_SDR_TARGET_SSE2 void sse2UnpackCS4(const __m128i in, __m128i &lo, __m128i &hi)
+{
+  const __m128i vMask = _mm_set1_epi8(int8_t(0xf0));
+  const __m128i i = _mm_and_si128(_mm_slli_epi16(in, 4), vMask);
+  const __m128i q = _mm_and_si128(in, vMask);
+  lo = _mm_unpacklo_epi8(i, q);
+  hi = _mm_unpackhi_epi8(i, q);
+}
+
+// CS8 > CS4: 32 parts > 16 bytes
+static inline SOAPY_SDR_TARGET_SSE2 __m128i sse2PackCS4(const __m128i lo, const __m128i hi)
+{
+  //each 16-bit lane holds one I/Q pair
+  const __m128i vLow = _mm_set1_epi16(0x000f);
+  const __m128i vHigh = _mm_set1_epi16(0x00f0);
+  const __m128i a = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(lo, 4), vLow), _mm_and_si128(_mm_srli_epi16(lo, 8), vHigh));
+  const __m128i b = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(hi, 4), vLow), _mm_and_si128(_mm_srli_epi16(hi, 8), vHigh));
+  return _mm_packus_epi16(a, b);
+}
+
+// The nibble kernels take the offset (0 or U4_ZERO_OFFSET) applied to each packed byte.
+// Integer kernels only vectorize without a scaler,
+// otherwise the scalar loop matches the generic converters.
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS4toS8Parts(const uint8_t *src, int8_t *dst, const size_t numElems, const uint8_t offset, const double scaler)
+{
+  const __m128i vOffset = _mm_set1_epi8(int8_t(offset));
+
+  size_t i = 0;
+  if (scaler == 1.0) for (; i+16 <= numElems; i += 16)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i)), vOffset), lo, hi);
+      _mm_storeu_si128((__m128i *)(dst+i*2+0), lo);
+      _mm_storeu_si128((__m128i *)(dst+i*2+16), hi);
+    }
+
+  for (; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(uint8_t(src[i] ^ offset), I, Q);
+      dst[i*2+0] = I * scaler;
+      dst[i*2+1] = Q * scaler;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2S8PartstoCS4(const int8_t *src, uint8_t *dst, const size_t numElems, const uint8_t offset, const double scaler)
+{
+  const __m128i vOffset = _mm_set1_epi8(int8_t(offset));
+
+  size_t i = 0;
+  if (scaler == 1.0) for (; i+16 <= numElems; i += 16)
+    {
+      const __m128i lo = _mm_loadu_si128((const __m128i *)(src+i*2+0));
+      const __m128i hi = _mm_loadu_si128((const __m128i *)(src+i*2+16));
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(sse2PackCS4(lo, hi), vOffset));
+    }
+
+  for (; i < numElems; i++)
+    {
+      const int8_t I = int8_t(src[i*2+0] * scaler);
+      const int8_t Q = int8_t(src[i*2+1] * scaler);
+      dst[i] = uint8_t(SoapySDR::CS8toCS4(I, Q) ^ offset);
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS4toS16Parts(const uint8_t *src, int16_t *dst, const size_t numElems, const uint8_t offset, const double scaler)
+{
+  const __m128i vOffset = _mm_set1_epi8(int8_t(offset));
+  const __m128i vZero = _mm_setzero_si128();
+
+  size_t i = 0;
+  if (scaler == 1.0) for (; i+16 <= numElems; i += 16)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i)), vOffset), lo, hi);
+      _mm_storeu_si128((__m128i *)(dst+i*2+0), _mm_unpacklo_epi8(vZero, lo));
+      _mm_storeu_si128((__m128i *)(dst+i*2+8), _mm_unpackhi_epi8(vZero, lo));
+      _mm_storeu_si128((__m128i *)(dst+i*2+16), _mm_unpacklo_epi8(vZero, hi));
+      _mm_storeu_si128((__m128i *)(dst+i*2+24), _mm_unpackhi_epi8(vZero, hi));
+    }
+
+  for (; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(uint8_t(src[i] ^ offset), I, Q);
+      dst[i*2+0] = SoapySDR::S8toS16(I) * scaler;
+      dst[i*2+1] = SoapySDR::S8toS16(Q) * scaler;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2S16PartstoCS4(const int16_t *src, uint8_t *dst, const size_t numElems, const uint8_t offset, const double scaler)
+{
+  const __m128i vOffset = _mm_set1_epi8(int8_t(offset));
+
+  size_t i = 0;
+  if (scaler == 1.0) for (; i+16 <= numElems; i += 16)
+    {
+      const __m128i a = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)(src+i*2+0)), 8);
+      const __m128i b = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)(src+i*2+8)), 8);
+      const __m128i c = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)(src+i*2+16)), 8);
+      const __m128i d = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)(src+i*2+24)), 8);
+      const __m128i packed = sse2PackCS4(_mm_packs_epi16(a, b), _mm_packs_epi16(c, d));
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(packed, vOffset));
+    }
+
+  for (; i < numElems; i++)
+    {
+      const int8_t I = SoapySDR::S16toS8(src[i*2+0] * scaler);
+      const int8_t Q = SoapySDR::S16toS8(src[i*2+1] * scaler);
+      dst[i] = uint8_t(SoapySDR::CS8toCS4(I, Q) ^ offset);
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS4toF32Parts(const uint8_t *src, float *dst, const size_t numElems, const uint8_t offset, const float scale)
+{
+  const __m128i vOffset = _mm_set1_epi8(int8_t(offset));
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numElems; i += 16)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i)), vOffset), lo, hi);
+      sse2S8x16toF32(lo, dst+i*2+0, vScale);
+      sse2S8x16toF32(hi, dst+i*2+16, vScale);
+    }
+
+  for (; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(uint8_t(src[i] ^ offset), I, Q);
+      dst[i*2+0] = float(I) * scale;
+      dst[i*2+1] = float(Q) * scale;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F32PartstoCS4(const float *src, uint8_t *dst, const size_t numElems, const uint8_t offset, const float scale)
+{
+  const __m128i vOffset = _mm_set1_epi8(int8_t(offset));
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numElems; i += 16)
+    {
+      const __m128i lo = sse2F32x16toS8(src+i*2+0, vScale);
+      const __m128i hi = sse2F32x16toS8(src+i*2+16, vScale);
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(sse2PackCS4(lo, hi), vOffset));
+    }
+
+  for (; i < numElems; i++)
+    {
+      const int8_t I = clampF32toS8(src[i*2+0] * scale);
+      const int8_t Q = clampF32toS8(src[i*2+1] * scale);
+      dst[i] = uint8_t(SoapySDR::CS8toCS4(I, Q) ^ offset);
+    }
+}
+
+// Clamps for the 32-bit integer and 64-bit float kernels.
+// The largest float below 2^31 is 2147483520, so 2^31 and beyond saturate to INT32_MAX
+// as in SoapySDR::F32toS32().
+
+static inline int32_t clampF32toS32(const float from)
+{
+  if (from >= 2147483648.0f) return 2147483647;
+  if (from <= -2147483648.0f) return int32_t(-2147483647-1);
+  return int32_t(from);
+}
+
+static inline int32_t clampF64toS32(const double from)
+{
+  if (from >= 2147483647.0) return 2147483647;
+  if (from <= -2147483648.0) return int32_t(-2147483647-1);
+  return int32_t(from);
+}
+
+static inline int16_t clampF64toS16(const double from)
+{
+  if (from >= 32767.0) return 32767;
+  if (from <= -32768.0) return -32768;
+  return int16_t(from);
+}
+
+// F32 > F64
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toF64Parts(const float *src, double *dst, const size_t numParts, const double scale)
+{
+  const __m128d vScale = _mm_set1_pd(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      const __m128 in = _mm_loadu_ps(src+i);
+      _mm_storeu_pd(dst+i+0, _mm_mul_pd(_mm_cvtps_pd(in), vScale));
+      _mm_storeu_pd(dst+i+2, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(in, in)), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = double(src[i]) * scale;
+    }
+}
+
+// F64 > F32
+static SOAPY_SDR_TARGET_SSE2 void sse2F64toF32Parts(const double *src, float *dst, const size_t numParts, const double scale)
+{
+  const __m128d vScale = _mm_set1_pd(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      const __m128 lo = _mm_cvtpd_ps(_mm_mul_pd(_mm_loadu_pd(src+i+0), vScale));
+      const __m128 hi = _mm_cvtpd_ps(_mm_mul_pd(_mm_loadu_pd(src+i+2), vScale));
+      _mm_storeu_ps(dst+i, _mm_movelh_ps(lo, hi));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(src[i] * scale);
+    }
+}
+
+// S16 > F64
+static SOAPY_SDR_TARGET_SSE2 void sse2S16toF64Parts(const int16_t *src, double *dst, const size_t numParts, const double scale)
+{
+  const __m128d vScale = _mm_set1_pd(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128i in = _mm_loadu_si128((const __m128i *)(src+i));
+      const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+      const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+      _mm_storeu_pd(dst+i+0, _mm_mul_pd(_mm_cvtepi32_pd(lo), vScale));
+      _mm_storeu_pd(dst+i+2, _mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2))), vScale));
+      _mm_storeu_pd(dst+i+4, _mm_mul_pd(_mm_cvtepi32_pd(hi), vScale));
+      _mm_storeu_pd(dst+i+6, _mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(hi, _MM_SHUFFLE(1, 0, 3, 2))), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = double(src[i]) * scale;
+    }
+}
+
+// F64 > S16
+static inline SOAPY_SDR_TARGET_SSE2 __m128i sse2F64x4toS32(const double *src, const __m128d vScale, const __m128d vMin, const __m128d vMax)
+{
+  const __m128i lo = _mm_cvttpd_epi32(_mm_min_pd(_mm_max_pd(_mm_mul_pd(_mm_loadu_pd(src+0), vScale), vMin), vMax));
+  const __m128i hi = _mm_cvttpd_epi32(_mm_min_pd(_mm_max_pd(_mm_mul_pd(_mm_loadu_pd(src+2), vScale), vMin), vMax));
+  return _mm_unpacklo_epi64(lo, hi);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F64toS16Parts(const double *src, int16_t *dst, const size_t numParts, const double scale)
+{
+  const __m128d vScale = _mm_set1_pd(scale);
+  const __m128d vMax = _mm_set1_pd(32767.0);
+  const __m128d vMin = _mm_set1_pd(-32768.0);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      const __m128i a = sse2F64x4toS32(src+i+0, vScale, vMin, vMax);
+      const __m128i b = sse2F64x4toS32(src+i+4, vScale, vMin, vMax);
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_packs_epi32(a, b));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = clampF64toS16(src[i] * scale);
+    }
+}
+
+// The 32-bit integer kernels take the offset (0 or U32_ZERO_OFFSET) applied to each part.
+
+// S32 > F32
+static SOAPY_SDR_TARGET_SSE2 void sse2S32toF32Parts(const uint32_t *src, float *dst, const size_t numParts, const uint32_t offset, const float scale)
+{
+  const __m128i vOffset = _mm_set1_epi32(int32_t(offset));
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      const __m128i in = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i)), vOffset);
+      _mm_storeu_ps(dst+i, _mm_mul_ps(_mm_cvtepi32_ps(in), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = float(int32_t(src[i] ^ offset)) * scale;
+    }
+}
+
+// F32 > S32
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toS32Parts(const float *src, uint32_t *dst, const size_t numParts, const uint32_t offset, const float scale)
+{
+  const __m128i vOffset = _mm_set1_epi32(int32_t(offset));
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMin = _mm_set1_ps(-2147483648.0f);
+  const __m128 vLimit = _mm_set1_ps(2147483648.0f);
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      //the conversion returns 0x80000000 from 2^31, flipping its bits saturates to 0x7fffffff
+      const __m128 in = _mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+i), vScale), vMin);
+      const __m128i over = _mm_castps_si128(_mm_cmpge_ps(in, vLimit));
+      const __m128i out = _mm_xor_si128(_mm_cvttps_epi32(in), over);
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(out, vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = uint32_t(clampF32toS32(src[i] * scale)) ^ offset;
+    }
+}
+
+// S32 > F64
+static SOAPY_SDR_TARGET_SSE2 void sse2S32toF64Parts(const uint32_t *src, double *dst, const size_t numParts, const uint32_t offset, const double scale)
+{
+  const __m128i vOffset = _mm_set1_epi32(int32_t(offset));
+  const __m128d vScale = _mm_set1_pd(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      const __m128i in = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i)), vOffset);
+      _mm_storeu_pd(dst+i+0, _mm_mul_pd(_mm_cvtepi32_pd(in), vScale));
+      _mm_storeu_pd(dst+i+2, _mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(in, _MM_SHUFFLE(1, 0, 3, 2))), vScale));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = double(int32_t(src[i] ^ offset)) * scale;
+    }
+}
+
+// F64 > S32
+static SOAPY_SDR_TARGET_SSE2 void sse2F64toS32Parts(const double *src, uint32_t *dst, const size_t numParts, const uint32_t offset, const double scale)
+{
+  const __m128i vOffset = _mm_set1_epi32(int32_t(offset));
+  const __m128d vScale = _mm_set1_pd(scale);
+  const __m128d vMax = _mm_set1_pd(2147483647.0);
+  const __m128d vMin = _mm_set1_pd(-2147483648.0);
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      _mm_storeu_si128((__m128i *)(dst+i), _mm_xor_si128(sse2F64x4toS32(src+i, vScale, vMin, vMax), vOffset));
+    }
+
+  for (; i < numParts; i++)
+    {
+      dst[i] = uint32_t(clampF64toS32(src[i] * scale)) ^ offset;
+    }
+}
+
+// Planar kernels split interleaved I/Q parts into I and Q planes (and back).
+// Each planar buffer is an array of 2 plane pointers (I, Q).
+
+// CF32 > F32 planes
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toF32Planes(const float *src, float *dstI, float *dstQ, const size_t numElems, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numElems; i += 4)
+    {
+      const __m128 a = _mm_loadu_ps(src+i*2+0);
+      const __m128 b = _mm_loadu_ps(src+i*2+4);
+      _mm_storeu_ps(dstI+i, _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), vScale));
+      _mm_storeu_ps(dstQ+i, _mm_mul_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)), vScale));
+    }
+
+  for (; i < numElems; i++)
+    {
+      dstI[i] = src[i*2+0] * scale;
+      dstQ[i] = src[i*2+1] * scale;
+    }
+}
+
+// F32 planes > CF32
+static SOAPY_SDR_TARGET_SSE2 void sse2F32PlanestoCF32(const float *srcI, const float *srcQ, float *dst, const size_t numElems, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numElems; i += 4)
+    {
+      const __m128 I = _mm_mul_ps(_mm_loadu_ps(srcI+i), vScale);
+      const __m128 Q = _mm_mul_ps(_mm_loadu_ps(srcQ+i), vScale);
+      _mm_storeu_ps(dst+i*2+0, _mm_unpacklo_ps(I, Q));
+      _mm_storeu_ps(dst+i*2+4, _mm_unpackhi_ps(I, Q));
+    }
+
+  for (; i < numElems; i++)
+    {
+      dst[i*2+0] = srcI[i] * scale;
+      dst[i*2+1] = srcQ[i] * scale;
+    }
+}
+
+// CS16 > F32 planes
+static SOAPY_SDR_TARGET_SSE2 void sse2CS16toF32Planes(const int16_t *src, float *dstI, float *dstQ, const size_t numElems, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numElems; i += 4)
+    {
+      //each 32-bit lane holds one element: I in the low half, Q in the high half
+      const __m128i in = _mm_loadu_si128((const __m128i *)(src+i*2));
+      const __m128i I = _mm_srai_epi32(_mm_slli_epi32(in, 16), 16);
+      const __m128i Q = _mm_srai_epi32(in, 16);
+      _mm_storeu_ps(dstI+i, _mm_mul_ps(_mm_cvtepi32_ps(I), vScale));
+      _mm_storeu_ps(dstQ+i, _mm_mul_ps(_mm_cvtepi32_ps(Q), vScale));
+    }
+
+  for (; i < numElems; i++)
+    {
+      dstI[i] = float(src[i*2+0]) * scale;
+      dstQ[i] = float(src[i*2+1]) * scale;
+    }
+}
+
+// F32 planes > CS16
+static SOAPY_SDR_TARGET_SSE2 void sse2F32PlanestoCS16(const float *srcI, const float *srcQ, int16_t *dst, const size_t numElems, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMax = _mm_set1_ps(32767.0f);
+  const __m128 vMin = _mm_set1_ps(-32768.0f);
+  const __m128i vMask = _mm_set1_epi32(0xffff);
+
+  size_t i = 0;
+  for (; i+4 <= numElems; i += 4)
+    {
+      const __m128i I = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(srcI+i), vScale), vMin), vMax));
+      const __m128i Q = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(srcQ+i), vScale), vMin), vMax));
+      _mm_storeu_si128((__m128i *)(dst+i*2), _mm_or_si128(_mm_and_si128(I, vMask), _mm_slli_epi32(Q, 16)));
+    }
+
+  for (; i < numElems; i++)
+    {
+      dst[i*2+0] = clampF32toS16(srcI[i] * scale);
+      dst[i*2+1] = clampF32toS16(srcQ[i] * scale);
+    }
+}
+
+// CS8 > F32 planes
+static SOAPY_SDR_TARGET_SSE2 void sse2CS8toF32Planes(const int8_t *src, float *dstI, float *dstQ, const size_t numElems, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numElems; i += 8)
+    {
+      //each 16-bit lane holds one element: I in the low byte, Q in the high byte
+      const __m128i in = _mm_loadu_si128((const __m128i *)(src+i*2));
+      const __m128i I = _mm_srai_epi16(_mm_slli_epi16(in, 8), 8);
+      const __m128i Q = _mm_srai_epi16(in, 8);
+      _mm_storeu_ps(dstI+i+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(I, I), 16)), vScale));
+      _mm_storeu_ps(dstI+i+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(I, I), 16)), vScale));
+      _mm_storeu_ps(dstQ+i+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(Q, Q), 16)), vScale));
+      _mm_storeu_ps(dstQ+i+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(Q, Q), 16)), vScale));
+    }
+
+  for (; i < numElems; i++)
+    {
+      dstI[i] = float(src[i*2+0]) * scale;
+      dstQ[i] = float(src[i*2+1]) * scale;
+    }
+}
+
+// F32 planes > CS8
+static SOAPY_SDR_TARGET_SSE2 void sse2F32PlanestoCS8(const float *srcI, const float *srcQ, int8_t *dst, const size_t numElems, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMax = _mm_set1_ps(127.0f);
+  const __m128 vMin = _mm_set1_ps(-128.0f);
+  const __m128i vMask = _mm_set1_epi16(0xff);
+
+  size_t i = 0;
+  for (; i+8 <= numElems; i += 8)
+    {
+      const __m128i I0 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(srcI+i+0), vScale), vMin), vMax));
+      const __m128i I1 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(srcI+i+4), vScale), vMin), vMax));
+      const __m128i Q0 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(srcQ+i+0), vScale), vMin), vMax));
+      const __m128i Q1 = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(srcQ+i+4), vScale), vMin), vMax));
+      const __m128i I = _mm_packs_epi32(I0, I1);
+      const __m128i Q = _mm_packs_epi32(Q0, Q1);
+      _mm_storeu_si128((__m128i *)(dst+i*2), _mm_or_si128(_mm_and_si128(I, vMask), _mm_slli_epi16(Q, 8)));
+    }
+
+  for (; i < numElems; i++)
+    {
+      dst[i*2+0] = clampF32toS8(srcI[i] * scale);
+      dst[i*2+1] = clampF32toS8(srcQ[i] * scale);
+    }
+}
+
+// ********************************
+// Converter Functions
+
+// F32 <> S16
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F32toS16Parts((const float *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2S16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2S16toF32Parts((const int16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// F32 <> U16
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F32toU16Parts((const float *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2U16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2U16toF32Parts((const uint16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// CF32 <> CS16
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F32toS16Parts((const float *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2S16toF32Parts((const int16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// CF32 <> CU16
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F32toU16Parts((const float *)srcBuff, (uint16_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CU16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2U16toF32Parts((const uint16_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+// F32 <> S8
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F32toS8Parts((const float *)srcBuff, (int8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2S8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2S8toF32Parts((const int8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// CF32 <> CS8
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F32toS8Parts((const float *)srcBuff, (int8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2S8toF32Parts((const int8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// F32 <> U8
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F32toU8Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2U8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2U8toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// CF32 <> CU8
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F32toU8Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2U8toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+// CS4 <> CS8
+static SOAPY_SDR_TARGET_SSE2 void sse2CS4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2CS4toS8Parts((const uint8_t *)srcBuff, (int8_t *)dstBuff, numElems, 0, scaler);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS8toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2S8PartstoCS4((const int8_t *)srcBuff, (uint8_t *)dstBuff, numElems, 0, scaler);
+}
+
+// CS4 <> CS16
+static SOAPY_SDR_TARGET_SSE2 void sse2CS4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2CS4toS16Parts((const uint8_t *)srcBuff, (int16_t *)dstBuff, numElems, 0, scaler);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS16toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2S16PartstoCS4((const int16_t *)srcBuff, (uint8_t *)dstBuff, numElems, 0, scaler);
+}
+
+// CS4 <> CF32
+static SOAPY_SDR_TARGET_SSE2 void sse2CS4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2CS4toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems, 0, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2F32PartstoCS4((const float *)srcBuff, (uint8_t *)dstBuff, numElems, 0, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+// CU4 <> CS8
+static SOAPY_SDR_TARGET_SSE2 void sse2CU4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2CS4toS8Parts((const uint8_t *)srcBuff, (int8_t *)dstBuff, numElems, SoapySDR::U4_ZERO_OFFSET, scaler);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS8toCU4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2S8PartstoCS4((const int8_t *)srcBuff, (uint8_t *)dstBuff, numElems, SoapySDR::U4_ZERO_OFFSET, scaler);
+}
+
+// CU4 <> CS16
+static SOAPY_SDR_TARGET_SSE2 void sse2CU4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2CS4toS16Parts((const uint8_t *)srcBuff, (int16_t *)dstBuff, numElems, SoapySDR::U4_ZERO_OFFSET, scaler);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CS16toCU4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2S16PartstoCS4((const int16_t *)srcBuff, (uint8_t *)dstBuff, numElems, SoapySDR::U4_ZERO_OFFSET, scaler);
+}
+
+// CU4 <> CF32
+static SOAPY_SDR_TARGET_SSE2 void sse2CU4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2CS4toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems, SoapySDR::U4_ZERO_OFFSET, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCU4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2F32PartstoCS4((const float *)srcBuff, (uint8_t *)dstBuff, numElems, SoapySDR::U4_ZERO_OFFSET, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+// F32 <> F64
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F32toF64Parts((const float *)srcBuff, (double *)dstBuff, numElems*elemDepth, scaler);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F64toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F64toF32Parts((const double *)srcBuff, (float *)dstBuff, numElems*elemDepth, scaler);
+}
+
+// S16 <> F64
+static SOAPY_SDR_TARGET_SSE2 void sse2S16toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2S16toF64Parts((const int16_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, scaler/SoapySDR::S16_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F64toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F64toS16Parts((const double *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, scaler*SoapySDR::S16_FULL_SCALE);
+}
+
+// S32 <> F32
+static SOAPY_SDR_TARGET_SSE2 void sse2S32toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2S32toF32Parts((const uint32_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, 0, float(scaler/SoapySDR::S32_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F32toS32Parts((const float *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, 0, float(scaler*SoapySDR::S32_FULL_SCALE));
+}
+
+// U32 <> F32
+static SOAPY_SDR_TARGET_SSE2 void sse2U32toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2S32toF32Parts((const uint32_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, float(scaler/SoapySDR::S32_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F32toU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F32toS32Parts((const float *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, float(scaler*SoapySDR::S32_FULL_SCALE));
+}
+
+// S32 <> F64
+static SOAPY_SDR_TARGET_SSE2 void sse2S32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2S32toF64Parts((const uint32_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, 0, scaler/SoapySDR::S32_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F64toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F64toS32Parts((const double *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, 0, scaler*SoapySDR::S32_FULL_SCALE);
+}
+
+// U32 <> F64
+static SOAPY_SDR_TARGET_SSE2 void sse2U32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2S32toF64Parts((const uint32_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, scaler/SoapySDR::S32_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2F64toU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse2F64toS32Parts((const double *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, scaler*SoapySDR::S32_FULL_SCALE);
+}
+
+// CF32 <> CF64
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F32toF64Parts((const float *)srcBuff, (double *)dstBuff, numElems*elemDepth, scaler);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF64toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F64toF32Parts((const double *)srcBuff, (float *)dstBuff, numElems*elemDepth, scaler);
+}
+
+// CS16 <> CF64
+static SOAPY_SDR_TARGET_SSE2 void sse2CS16toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2S16toF64Parts((const int16_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, scaler/SoapySDR::S16_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF64toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F64toS16Parts((const double *)srcBuff, (int16_t *)dstBuff, numElems*elemDepth, scaler*SoapySDR::S16_FULL_SCALE);
+}
+
+// CS32 <> CF32
+static SOAPY_SDR_TARGET_SSE2 void sse2CS32toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2S32toF32Parts((const uint32_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, 0, float(scaler/SoapySDR::S32_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F32toS32Parts((const float *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, 0, float(scaler*SoapySDR::S32_FULL_SCALE));
+}
+
+// CU32 <> CF32
+static SOAPY_SDR_TARGET_SSE2 void sse2CU32toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2S32toF32Parts((const uint32_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, float(scaler/SoapySDR::S32_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F32toS32Parts((const float *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, float(scaler*SoapySDR::S32_FULL_SCALE));
+}
+
+// CS32 <> CF64
+static SOAPY_SDR_TARGET_SSE2 void sse2CS32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2S32toF64Parts((const uint32_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, 0, scaler/SoapySDR::S32_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF64toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F64toS32Parts((const double *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, 0, scaler*SoapySDR::S32_FULL_SCALE);
+}
+
+// CU32 <> CF64
+static SOAPY_SDR_TARGET_SSE2 void sse2CU32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2S32toF64Parts((const uint32_t *)srcBuff, (double *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, scaler/SoapySDR::S32_FULL_SCALE);
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF64toCU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2F64toS32Parts((const double *)srcBuff, (uint32_t *)dstBuff, numElems*elemDepth, SoapySDR::U32_ZERO_OFFSET, scaler*SoapySDR::S32_FULL_SCALE);
+}
+
+// CF32 <> CF32_PLANAR
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32toCF32Planar(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  float *const *dst = (float *const *)dstBuff;
+  sse2CF32toF32Planes((const float *)srcBuff, dst[0], dst[1], numElems, float(scaler));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32PlanartoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const float *const *src = (const float *const *)srcBuff;
+  sse2F32PlanestoCF32(src[0], src[1], (float *)dstBuff, numElems, float(scaler));
+}
+
+// CS16 <> CF32_PLANAR
+static SOAPY_SDR_TARGET_SSE2 void sse2CS16toCF32Planar(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  float *const *dst = (float *const *)dstBuff;
+  sse2CS16toF32Planes((const int16_t *)srcBuff, dst[0], dst[1], numElems, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32PlanartoCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const float *const *src = (const float *const *)srcBuff;
+  sse2F32PlanestoCS16(src[0], src[1], (int16_t *)dstBuff, numElems, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+// CS8 <> CF32_PLANAR
+static SOAPY_SDR_TARGET_SSE2 void sse2CS8toCF32Planar(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  float *const *dst = (float *const *)dstBuff;
+  sse2CS8toF32Planes((const int8_t *)srcBuff, dst[0], dst[1], numElems, float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE2 void sse2CF32PlanartoCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const float *const *src = (const float *const *)srcBuff;
+  sse2F32PlanestoCS8(src[0], src[1], (int8_t *)dstBuff, numElems, float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+#endif //SOAPY_SDR_CONVERTER_X86
+
+/*!
+ * Register the SSE2 converters at VECTORIZED priority.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadSSE2Converters(void)
+{
+#ifdef SOAPY_SDR_CONVERTER_X86
+    static SoapySDR::ConverterRegistry registerSSE2F32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F32toS16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2S16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2S16toF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F32toU16(SOAPY_SDR_F32, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F32toU16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2U16toF32(SOAPY_SDR_U16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2U16toF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCS16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS16toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCU16(SOAPY_SDR_CF32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCU16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CU16toCF32(SOAPY_SDR_CU16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU16toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F32toS8, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2S8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2S8toF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F32toU8, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2U8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2U8toF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCS8, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS8toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCU8, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU8toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS4toCS8(SOAPY_SDR_CS4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS4toCS8, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS8toCS4(SOAPY_SDR_CS8, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS8toCS4, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS4toCS16(SOAPY_SDR_CS4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS4toCS16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS16toCS4(SOAPY_SDR_CS16, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS16toCS4, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS4toCF32(SOAPY_SDR_CS4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS4toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCS4(SOAPY_SDR_CF32, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCS4, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CU4toCS8(SOAPY_SDR_CU4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU4toCS8, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS8toCU4(SOAPY_SDR_CS8, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS8toCU4, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CU4toCS16(SOAPY_SDR_CU4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU4toCS16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS16toCU4(SOAPY_SDR_CS16, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS16toCU4, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CU4toCF32(SOAPY_SDR_CU4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU4toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCU4(SOAPY_SDR_CF32, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCU4, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F32toF64(SOAPY_SDR_F32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F32toF64, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F64toF32(SOAPY_SDR_F64, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F64toF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2S16toF64(SOAPY_SDR_S16, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, &sse2S16toF64, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F64toS16(SOAPY_SDR_F64, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F64toS16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2S32toF32(SOAPY_SDR_S32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2S32toF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F32toS32(SOAPY_SDR_F32, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F32toS32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2U32toF32(SOAPY_SDR_U32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2U32toF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F32toU32(SOAPY_SDR_F32, SOAPY_SDR_U32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F32toU32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2S32toF64(SOAPY_SDR_S32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, &sse2S32toF64, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F64toS32(SOAPY_SDR_F64, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F64toS32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2U32toF64(SOAPY_SDR_U32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::VECTORIZED, &sse2U32toF64, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2F64toU32(SOAPY_SDR_F64, SOAPY_SDR_U32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2F64toU32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCF64(SOAPY_SDR_CF32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCF64, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF64toCF32(SOAPY_SDR_CF64, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF64toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS16toCF64(SOAPY_SDR_CS16, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS16toCF64, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF64toCS16(SOAPY_SDR_CF64, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF64toCS16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS32toCF32(SOAPY_SDR_CS32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS32toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCS32(SOAPY_SDR_CF32, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCS32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CU32toCF32(SOAPY_SDR_CU32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU32toCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCU32(SOAPY_SDR_CF32, SOAPY_SDR_CU32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCU32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS32toCF64(SOAPY_SDR_CS32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS32toCF64, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF64toCS32(SOAPY_SDR_CF64, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF64toCS32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CU32toCF64(SOAPY_SDR_CU32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CU32toCF64, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF64toCU32(SOAPY_SDR_CF64, SOAPY_SDR_CU32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF64toCU32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32toCF32Planar(SOAPY_SDR_CF32, SOAPY_SDR_CF32_PLANAR, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32toCF32Planar, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32PlanartoCF32(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32PlanartoCF32, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS16toCF32Planar(SOAPY_SDR_CS16, SOAPY_SDR_CF32_PLANAR, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS16toCF32Planar, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32PlanartoCS16(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32PlanartoCS16, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CS8toCF32Planar(SOAPY_SDR_CS8, SOAPY_SDR_CF32_PLANAR, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CS8toCF32Planar, SoapySDR::ConverterRegistry::ISA_SSE2);
+    static SoapySDR::ConverterRegistry registerSSE2CF32PlanartoCS8(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse2CF32PlanartoCS8, SoapySDR::ConverterRegistry::ISA_SSE2);
+#endif //SOAPY_SDR_CONVERTER_X86
+}
@@ -0,0 +1,670 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ConverterISA.hpp"
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <cstring> //memcpy
+
+#ifdef SOAPY_SDR_CONVERTER_X86
+#include <smmintrin.h>
+
+// ********************************
+// SSE4.1 Kernels
+//
+// The packed 12-bit kernels work on 4 complex samples (12 bytes) at a time.
+// A byte shuffle gathers the 2 bytes behind each 12-bit value into a 16-bit lane,
+// then a shift (I) or mask (Q) left-justifies the value as a CS16 sample.
+
+static inline int16_t clampF32toS16(const float from)
+{
+  if (from >= 32767.0f) return 32767;
+  if (from <= -32768.0f) return -32768;
+  return int16_t(from);
+}
+
+// 12 bytes of CS12 > 8 left-justified CS16 parts
+static inline SOAPY_SDR_TARGET_SSE41 __m128i sse41UnpackCS12(const uint8_t *src)
+{
+  const __m128i vShuffle = _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+  const __m128i vMask = _mm_set1_epi16(int16_t(0xfff0));
+  const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), vShuffle);
+  return _mm_blend_epi16(_mm_slli_epi16(in, 4), _mm_and_si128(in, vMask), 0xaa);
+}
+
+// 8 CS16 parts > 12 bytes of CS12
+static inline SOAPY_SDR_TARGET_SSE41 void sse41PackCS12(const __m128i in, uint8_t *dst)
+{
+  const __m128i vMask = _mm_set1_epi16(int16_t(0xfff0));
+  const __m128i vOuter = _mm_setr_epi8(0, 1, 3, 4, 5, 7, 8, 9, 11, 12, 13, 15, -1, -1, -1, -1);
+  const __m128i vInner = _mm_setr_epi8(-1, 2, -1, -1, 6, -1, -1, 10, -1, -1, 14, -1, -1, -1, -1, -1);
+
+  //per sample: [I bits 4-11, I bits 12-15, Q bits 4-7, Q bits 8-15]
+  const __m128i words = _mm_blend_epi16(_mm_srli_epi16(in, 4), _mm_and_si128(in, vMask), 0xaa);
+  const __m128i out = _mm_or_si128(_mm_shuffle_epi8(words, vOuter), _mm_shuffle_epi8(words, vInner));
+
+  const int32_t last = _mm_cvtsi128_si32(_mm_srli_si128(out, 8));
+  _mm_storel_epi64((__m128i *)dst, out);
+  std::memcpy(dst+8, &last, sizeof(last));
+}
+
+// CS12 > CS16 parts, offset XORs each part (CU12 > CS16)
+static SOAPY_SDR_TARGET_SSE41 void sse41CS12toS16Parts(const uint8_t *src, int16_t *dst, const size_t numElems, const int16_t offset)
+{
+  const __m128i vOffset = _mm_set1_epi16(offset);
+
+  //the 16 byte load reads past the 12 bytes consumed per iteration
+  size_t i = 0;
+  for (; i+6 <= numElems; i += 4)
+    {
+      const __m128i in = _mm_xor_si128(sse41UnpackCS12(src+i*3), vOffset);
+      _mm_storeu_si128((__m128i *)(dst+i*2), in);
+    }
+
+  for (; i < numElems; i++)
+    {
+      int16_t I, Q;
+      SoapySDR::CS12toCS16(src+i*3, I, Q);
+      dst[i*2+0] = int16_t(I ^ offset);
+      dst[i*2+1] = int16_t(Q ^ offset);
+    }
+}
+
+// CS16 parts > CS12, offset XORs each part (CS16 > CU12)
+static SOAPY_SDR_TARGET_SSE41 void sse41S16PartstoCS12(const int16_t *src, uint8_t *dst, const size_t numElems, const int16_t offset)
+{
+  const __m128i vOffset = _mm_set1_epi16(offset);
+
+  size_t i = 0;
+  for (; i+4 <= numElems; i += 4)
+    {
+      const __m128i in = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(src+i*2)), vOffset);
+      sse41PackCS12(in, dst+i*3);
+    }
+
+  for (; i < numElems; i++)
+    {
+      SoapySDR::CS16toCS12(int16_t(src[i*2+0] ^ offset), int16_t(src[i*2+1] ^ offset), dst+i*3);
+    }
+}
+
+// CS12 > CF32, offset XORs each left-justified part (CU12 > CF32)
+static SOAPY_SDR_TARGET_SSE41 void sse41CS12toF32Parts(const uint8_t *src, float *dst, const size_t numElems, const int16_t offset, const float scale)
+{
+  const __m128i vOffset = _mm_set1_epi16(offset);
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  //the 16 byte load reads past the 12 bytes consumed per iteration
+  size_t i = 0;
+  for (; i+6 <= numElems; i += 4)
+    {
+      const __m128i in = _mm_xor_si128(sse41UnpackCS12(src+i*3), vOffset);
+      const __m128i lo = _mm_cvtepi16_epi32(in);
+      const __m128i hi = _mm_cvtepi16_epi32(_mm_srli_si128(in, 8));
+      _mm_storeu_ps(dst+i*2+0, _mm_mul_ps(_mm_cvtepi32_ps(lo), vScale));
+      _mm_storeu_ps(dst+i*2+4, _mm_mul_ps(_mm_cvtepi32_ps(hi), vScale));
+    }
+
+  for (; i < numElems; i++)
+    {
+      int16_t I, Q;
+      SoapySDR::CS12toCS16(src+i*3, I, Q);
+      dst[i*2+0] = float(int16_t(I ^ offset)) * scale;
+      dst[i*2+1] = float(int16_t(Q ^ offset)) * scale;
+    }
+}
+
+// CF32 > CS12, offset XORs each part before packing (CF32 > CU12)
+static SOAPY_SDR_TARGET_SSE41 void sse41F32PartstoCS12(const float *src, uint8_t *dst, const size_t numElems, const int16_t offset, const float scale)
+{
+  const __m128i vOffset = _mm_set1_epi16(offset);
+  const __m128 vScale = _mm_set1_ps(scale);
+  const __m128 vMax = _mm_set1_ps(32767.0f);
+  const __m128 vMin = _mm_set1_ps(-32768.0f);
+
+  size_t i = 0;
+  for (; i+4 <= numElems; i += 4)
+    {
+      const __m128 a = _mm_mul_ps(_mm_loadu_ps(src+i*2+0), vScale);
+      const __m128 b = _mm_mul_ps(_mm_loadu_ps(src+i*2+4), vScale);
+      const __m128i ia = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(a, vMin), vMax));
+      const __m128i ib = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(b, vMin), vMax));
+      sse41PackCS12(_mm_xor_si128(_mm_packs_epi32(ia, ib), vOffset), dst+i*3);
+    }
+
+  for (; i < numElems; i++)
+    {
+      const int16_t I = clampF32toS16(src[i*2+0] * scale);
+      const int16_t Q = clampF32toS16(src[i*2+1] * scale);
+      SoapySDR::CS16toCS12(int16_t(I ^ offset), int16_t(Q ^ offset), dst+i*3);
+    }
+}
+
+// ********************************
+// Swapped wire format kernels
+//
+// A byte shuffle reorders each block before or after the conversion:
+// it swaps the bytes of big endian parts on the little endian x86 hosts,
+// or the I and Q parts of each element.
+// The remainder is converted through a zero padded block.
+
+static inline SOAPY_SDR_TARGET_SSE41 __m128i sse41SwapBytes16(void)
+{
+  return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+}
+
+static inline SOAPY_SDR_TARGET_SSE41 __m128i sse41SwapBytes32(void)
+{
+  return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+}
+
+static inline SOAPY_SDR_TARGET_SSE41 __m128i sse41SwapParts16(void)
+{
+  return _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+}
+
+// 8 swapped S16 parts > F32
+static inline SOAPY_SDR_TARGET_SSE41 void sse41SwapS16x8toF32(const uint8_t *src, float *dst, const __m128i shuffle, const __m128 vScale)
+{
+  const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), shuffle);
+  _mm_storeu_ps(dst+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(in)), vScale));
+  _mm_storeu_ps(dst+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(in, 8))), vScale));
+}
+
+// 8 F32 parts > swapped S16
+static inline SOAPY_SDR_TARGET_SSE41 void sse41F32x8toSwapS16(const float *src, uint8_t *dst, const __m128i shuffle, const __m128 vScale)
+{
+  const __m128 vMax = _mm_set1_ps(32767.0f);
+  const __m128 vMin = _mm_set1_ps(-32768.0f);
+  const __m128i a = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+0), vScale), vMin), vMax));
+  const __m128i b = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+4), vScale), vMin), vMax));
+  _mm_storeu_si128((__m128i *)dst, _mm_shuffle_epi8(_mm_packs_epi32(a, b), shuffle));
+}
+
+// 16 swapped S8 parts > F32
+static inline SOAPY_SDR_TARGET_SSE41 void sse41SwapS8x16toF32(const uint8_t *src, float *dst, const __m128i shuffle, const __m128 vScale)
+{
+  const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), shuffle);
+  _mm_storeu_ps(dst+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(in)), vScale));
+  _mm_storeu_ps(dst+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(in, 4))), vScale));
+  _mm_storeu_ps(dst+8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(in, 8))), vScale));
+  _mm_storeu_ps(dst+12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(in, 12))), vScale));
+}
+
+// 16 F32 parts > swapped S8
+static inline SOAPY_SDR_TARGET_SSE41 void sse41F32x16toSwapS8(const float *src, uint8_t *dst, const __m128i shuffle, const __m128 vScale)
+{
+  const __m128 vMax = _mm_set1_ps(127.0f);
+  const __m128 vMin = _mm_set1_ps(-128.0f);
+  const __m128i a = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+0), vScale), vMin), vMax));
+  const __m128i b = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+4), vScale), vMin), vMax));
+  const __m128i c = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+8), vScale), vMin), vMax));
+  const __m128i d = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src+12), vScale), vMin), vMax));
+  const __m128i packed = _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+  _mm_storeu_si128((__m128i *)dst, _mm_shuffle_epi8(packed, shuffle));
+}
+
+// 4 big endian F32 parts > F32
+static inline SOAPY_SDR_TARGET_SSE41 void sse41SwapF32x4toF32(const uint8_t *src, float *dst, const __m128i shuffle, const __m128 vScale)
+{
+  const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), shuffle);
+  _mm_storeu_ps(dst, _mm_mul_ps(_mm_castsi128_ps(in), vScale));
+}
+
+// 4 F32 parts > big endian F32
+static inline SOAPY_SDR_TARGET_SSE41 void sse41F32x4toSwapF32(const float *src, uint8_t *dst, const __m128i shuffle, const __m128 vScale)
+{
+  const __m128 in = _mm_mul_ps(_mm_loadu_ps(src), vScale);
+  _mm_storeu_si128((__m128i *)dst, _mm_shuffle_epi8(_mm_castps_si128(in), shuffle));
+}
+
+// 16 bytes > 16 shuffled bytes
+static inline SOAPY_SDR_TARGET_SSE41 void sse41Swapx16(const uint8_t *src, uint8_t *dst, const __m128i shuffle)
+{
+  _mm_storeu_si128((__m128i *)dst, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), shuffle));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41SwapS16toF32Parts(const uint8_t *src, float *dst, const size_t numParts, const __m128i shuffle, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      sse41SwapS16x8toF32(src+i*2, dst+i, shuffle, vScale);
+    }
+  if (i == numParts) return;
+
+  uint8_t inBlock[16] = {};
+  float outBlock[8];
+  std::memcpy(inBlock, src+i*2, (numParts-i)*2);
+  sse41SwapS16x8toF32(inBlock, outBlock, shuffle, vScale);
+  std::memcpy(dst+i, outBlock, (numParts-i)*4);
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41F32toSwapS16Parts(const float *src, uint8_t *dst, const size_t numParts, const __m128i shuffle, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+8 <= numParts; i += 8)
+    {
+      sse41F32x8toSwapS16(src+i, dst+i*2, shuffle, vScale);
+    }
+  if (i == numParts) return;
+
+  float inBlock[8] = {};
+  uint8_t outBlock[16];
+  std::memcpy(inBlock, src+i, (numParts-i)*4);
+  sse41F32x8toSwapS16(inBlock, outBlock, shuffle, vScale);
+  std::memcpy(dst+i*2, outBlock, (numParts-i)*2);
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41SwapS8toF32Parts(const uint8_t *src, float *dst, const size_t numParts, const __m128i shuffle, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      sse41SwapS8x16toF32(src+i*1, dst+i, shuffle, vScale);
+    }
+  if (i == numParts) return;
+
+  uint8_t inBlock[16] = {};
+  float outBlock[16];
+  std::memcpy(inBlock, src+i*1, (numParts-i)*1);
+  sse41SwapS8x16toF32(inBlock, outBlock, shuffle, vScale);
+  std::memcpy(dst+i, outBlock, (numParts-i)*4);
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41F32toSwapS8Parts(const float *src, uint8_t *dst, const size_t numParts, const __m128i shuffle, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+16 <= numParts; i += 16)
+    {
+      sse41F32x16toSwapS8(src+i, dst+i*1, shuffle, vScale);
+    }
+  if (i == numParts) return;
+
+  float inBlock[16] = {};
+  uint8_t outBlock[16];
+  std::memcpy(inBlock, src+i, (numParts-i)*4);
+  sse41F32x16toSwapS8(inBlock, outBlock, shuffle, vScale);
+  std::memcpy(dst+i*1, outBlock, (numParts-i)*1);
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41SwapF32toF32Parts(const uint8_t *src, float *dst, const size_t numParts, const __m128i shuffle, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      sse41SwapF32x4toF32(src+i*4, dst+i, shuffle, vScale);
+    }
+  if (i == numParts) return;
+
+  uint8_t inBlock[16] = {};
+  float outBlock[4];
+  std::memcpy(inBlock, src+i*4, (numParts-i)*4);
+  sse41SwapF32x4toF32(inBlock, outBlock, shuffle, vScale);
+  std::memcpy(dst+i, outBlock, (numParts-i)*4);
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41F32toSwapF32Parts(const float *src, uint8_t *dst, const size_t numParts, const __m128i shuffle, const float scale)
+{
+  const __m128 vScale = _mm_set1_ps(scale);
+
+  size_t i = 0;
+  for (; i+4 <= numParts; i += 4)
+    {
+      sse41F32x4toSwapF32(src+i, dst+i*4, shuffle, vScale);
+    }
+  if (i == numParts) return;
+
+  float inBlock[4] = {};
+  uint8_t outBlock[16];
+  std::memcpy(inBlock, src+i, (numParts-i)*4);
+  sse41F32x4toSwapF32(inBlock, outBlock, shuffle, vScale);
+  std::memcpy(dst+i*4, outBlock, (numParts-i)*4);
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41SwapBytes(const uint8_t *src, uint8_t *dst, const size_t numBytes, const __m128i shuffle)
+{
+  size_t i = 0;
+  for (; i+16 <= numBytes; i += 16)
+    {
+      sse41Swapx16(src+i, dst+i, shuffle);
+    }
+  if (i == numBytes) return;
+
+  uint8_t inBlock[16] = {};
+  uint8_t outBlock[16];
+  std::memcpy(inBlock, src+i, numBytes-i);
+  sse41Swapx16(inBlock, outBlock, shuffle);
+  std::memcpy(dst+i, outBlock, numBytes-i);
+}
+
+// ********************************
+// Converter Functions
+//
+// Integer to integer conversions take the fast path without a scaler,
+// and fall back to the scalar loop like the generic converters otherwise.
+
+// CS12 <> CS16
+static SOAPY_SDR_TARGET_SSE41 void sse41CS12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse41CS12toS16Parts((const uint8_t *)srcBuff, (int16_t *)dstBuff, numElems, 0);
+  if (scaler == 1.0) return;
+
+  const size_t elemDepth = 2;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = dst[i] * scaler;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CS16toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  if (scaler == 1.0) return sse41S16PartstoCS12((const int16_t *)srcBuff, (uint8_t *)dstBuff, numElems, 0);
+
+  const size_t elemDepth = 2;
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int16_t I = src[i*elemDepth+0] * scaler;
+      const int16_t Q = src[i*elemDepth+1] * scaler;
+      SoapySDR::CS16toCS12(I, Q, dst+i*3);
+    }
+}
+
+// CS12 <> CF32
+static SOAPY_SDR_TARGET_SSE41 void sse41CS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse41CS12toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems, 0, float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse41F32PartstoCS12((const float *)srcBuff, (uint8_t *)dstBuff, numElems, 0, float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+// CU12 <> CU16
+static SOAPY_SDR_TARGET_SSE41 void sse41CU12toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse41CS12toS16Parts((const uint8_t *)srcBuff, (int16_t *)dstBuff, numElems, 0);
+  if (scaler == 1.0) return;
+
+  const size_t elemDepth = 2;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = dst[i] * scaler;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CU16toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  if (scaler == 1.0) return sse41S16PartstoCS12((const int16_t *)srcBuff, (uint8_t *)dstBuff, numElems, 0);
+
+  const size_t elemDepth = 2;
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const uint16_t I = src[i*elemDepth+0] * scaler;
+      const uint16_t Q = src[i*elemDepth+1] * scaler;
+      SoapySDR::CS16toCS12(int16_t(I), int16_t(Q), dst+i*3);
+    }
+}
+
+// CU12 <> CF32
+static SOAPY_SDR_TARGET_SSE41 void sse41CU12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse41CS12toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems, int16_t(SoapySDR::U16_ZERO_OFFSET), float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CF32toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse41F32PartstoCS12((const float *)srcBuff, (uint8_t *)dstBuff, numElems, int16_t(SoapySDR::U16_ZERO_OFFSET), float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+// CS16_BE <> CF32
+static SOAPY_SDR_TARGET_SSE41 void sse41CS16BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse41SwapS16toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, sse41SwapBytes16(), float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CF32toCS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse41F32toSwapS16Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, sse41SwapBytes16(), float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+// CS16_BE <> CS16
+static SOAPY_SDR_TARGET_SSE41 void sse41CS16BEtoCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0) return sse41SwapBytes((const uint8_t *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth*sizeof(int16_t), sse41SwapBytes16());
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16BEtoS16(uint16_t(src[i])) * scaler;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CS16toCS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0) return sse41SwapBytes((const uint8_t *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth*sizeof(int16_t), sse41SwapBytes16());
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = int16_t(SoapySDR::S16toS16BE(int16_t(src[i] * scaler)));
+    }
+}
+
+// CS16_QI <> CF32
+static SOAPY_SDR_TARGET_SSE41 void sse41CS16QItoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse41SwapS16toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, sse41SwapParts16(), float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CF32toCS16QI(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse41F32toSwapS16Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, sse41SwapParts16(), float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+// CS16_QI <> CS16
+static SOAPY_SDR_TARGET_SSE41 void sse41CS16QItoCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0) return sse41SwapBytes((const uint8_t *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth*sizeof(int16_t), sse41SwapParts16());
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = src[i^1] * scaler;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CS16toCS16QI(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0) return sse41SwapBytes((const uint8_t *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth*sizeof(int16_t), sse41SwapParts16());
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = src[i^1] * scaler;
+    }
+}
+
+// S16_BE <> F32
+static SOAPY_SDR_TARGET_SSE41 void sse41S16BEtoF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse41SwapS16toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, sse41SwapBytes16(), float(scaler/SoapySDR::S16_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41F32toS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse41F32toSwapS16Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, sse41SwapBytes16(), float(scaler*SoapySDR::S16_FULL_SCALE));
+}
+
+// S16_BE <> S16
+static SOAPY_SDR_TARGET_SSE41 void sse41S16BEtoS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  if (scaler == 1.0) return sse41SwapBytes((const uint8_t *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth*sizeof(int16_t), sse41SwapBytes16());
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16BEtoS16(uint16_t(src[i])) * scaler;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41S16toS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  if (scaler == 1.0) return sse41SwapBytes((const uint8_t *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth*sizeof(int16_t), sse41SwapBytes16());
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = int16_t(SoapySDR::S16toS16BE(int16_t(src[i] * scaler)));
+    }
+}
+
+// CS8_QI <> CF32
+static SOAPY_SDR_TARGET_SSE41 void sse41CS8QItoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse41SwapS8toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, sse41SwapBytes16(), float(scaler/SoapySDR::S8_FULL_SCALE));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CF32toCS8QI(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse41F32toSwapS8Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, sse41SwapBytes16(), float(scaler*SoapySDR::S8_FULL_SCALE));
+}
+
+// CS8_QI <> CS8
+static SOAPY_SDR_TARGET_SSE41 void sse41CS8QItoCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0) return sse41SwapBytes((const uint8_t *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth*sizeof(int8_t), sse41SwapBytes16());
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = src[i^1] * scaler;
+    }
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CS8toCS8QI(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0) return sse41SwapBytes((const uint8_t *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth*sizeof(int8_t), sse41SwapBytes16());
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = src[i^1] * scaler;
+    }
+}
+
+// CF32_BE <> CF32
+static SOAPY_SDR_TARGET_SSE41 void sse41CF32BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse41SwapF32toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, sse41SwapBytes32(), float(scaler));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41CF32toCF32BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse41F32toSwapF32Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, sse41SwapBytes32(), float(scaler));
+}
+
+// F32_BE <> F32
+static SOAPY_SDR_TARGET_SSE41 void sse41F32BEtoF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse41SwapF32toF32Parts((const uint8_t *)srcBuff, (float *)dstBuff, numElems*elemDepth, sse41SwapBytes32(), float(scaler));
+}
+
+static SOAPY_SDR_TARGET_SSE41 void sse41F32toF32BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+  sse41F32toSwapF32Parts((const float *)srcBuff, (uint8_t *)dstBuff, numElems*elemDepth, sse41SwapBytes32(), float(scaler));
+}
+
+#endif //SOAPY_SDR_CONVERTER_X86
+
+/*!
+ * Register the SSE4.1 converters at VECTORIZED priority.
+ * Called from lateLoadDefaultConverters().
+ */
+void lateLoadSSE41Converters(void)
+{
+#ifdef SOAPY_SDR_CONVERTER_X86
+    static SoapySDR::ConverterRegistry registerSSE41CS12toCS16(SOAPY_SDR_CS12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS12toCS16, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS16toCS12(SOAPY_SDR_CS16, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16toCS12, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS12toCF32(SOAPY_SDR_CS12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS12toCF32, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CF32toCS12, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CU12toCU16(SOAPY_SDR_CU12, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CU12toCU16, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CU16toCU12(SOAPY_SDR_CU16, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CU16toCU12, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CU12toCF32(SOAPY_SDR_CU12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CU12toCF32, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CF32toCU12(SOAPY_SDR_CF32, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CF32toCU12, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS16BEtoCF32(SOAPY_SDR_CS16_BE, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16BEtoCF32, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CF32toCS16BE(SOAPY_SDR_CF32, SOAPY_SDR_CS16_BE, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CF32toCS16BE, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS16BEtoCS16(SOAPY_SDR_CS16_BE, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16BEtoCS16, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS16toCS16BE(SOAPY_SDR_CS16, SOAPY_SDR_CS16_BE, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16toCS16BE, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS16QItoCF32(SOAPY_SDR_CS16_QI, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16QItoCF32, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CF32toCS16QI(SOAPY_SDR_CF32, SOAPY_SDR_CS16_QI, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CF32toCS16QI, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS16QItoCS16(SOAPY_SDR_CS16_QI, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16QItoCS16, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS16toCS16QI(SOAPY_SDR_CS16, SOAPY_SDR_CS16_QI, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS16toCS16QI, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41S16BEtoF32(SOAPY_SDR_S16_BE, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41S16BEtoF32, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41F32toS16BE(SOAPY_SDR_F32, SOAPY_SDR_S16_BE, SoapySDR::ConverterRegistry::VECTORIZED, &sse41F32toS16BE, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41S16BEtoS16(SOAPY_SDR_S16_BE, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::VECTORIZED, &sse41S16BEtoS16, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41S16toS16BE(SOAPY_SDR_S16, SOAPY_SDR_S16_BE, SoapySDR::ConverterRegistry::VECTORIZED, &sse41S16toS16BE, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS8QItoCF32(SOAPY_SDR_CS8_QI, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS8QItoCF32, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CF32toCS8QI(SOAPY_SDR_CF32, SOAPY_SDR_CS8_QI, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CF32toCS8QI, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS8QItoCS8(SOAPY_SDR_CS8_QI, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS8QItoCS8, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CS8toCS8QI(SOAPY_SDR_CS8, SOAPY_SDR_CS8_QI, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CS8toCS8QI, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CF32BEtoCF32(SOAPY_SDR_CF32_BE, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CF32BEtoCF32, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41CF32toCF32BE(SOAPY_SDR_CF32, SOAPY_SDR_CF32_BE, SoapySDR::ConverterRegistry::VECTORIZED, &sse41CF32toCF32BE, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41F32BEtoF32(SOAPY_SDR_F32_BE, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::VECTORIZED, &sse41F32BEtoF32, SoapySDR::ConverterRegistry::ISA_SSE41);
+    static SoapySDR::ConverterRegistry registerSSE41F32toF32BE(SOAPY_SDR_F32, SOAPY_SDR_F32_BE, SoapySDR::ConverterRegistry::VECTORIZED, &sse41F32toF32BE, SoapySDR::ConverterRegistry::ISA_SSE41);
+#endif //SOAPY_SDR_CONVERTER_X86
+}
@@ -8,6 +8,16 @@
 #include <SoapySDR/ConverterRegistry.hpp>
 #include <SoapySDR/Formats.hpp>
 #include <cstring> //memcpy
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+void lateLoadSSE2Converters(void);
+void lateLoadSSE41Converters(void);
+void lateLoadAVX2Converters(void);
+void lateLoadAVX512Converters(void);
+void lateLoadDitherConverters(void);
 
 // ********************************
 // Real Soapy Formats
@@ -516,6 +526,93 @@ static void genericCU8toCF32(const void *srcBuff, void *dstBuff, const size_t nu
     }
 }
 
+// CS8/CU8 > CF32 lookup tables
+//
+// A 64K entry table indexed by the raw 16-bit I/Q pair holds the complete
+// complex float, so each element is one load and one store.
+// A table is built on first use for each scaler value and kept for the
+// life of the process, up to LUT_MAX_TABLES per format;
+// other scalers fall back to the generic arithmetic.
+
+static const size_t LUT_MAX_TABLES = 8;
+
+struct ComplexLUT
+{
+  double scaler;
+  uint64_t entries[1 << 16];
+};
+
+static inline float lutPartToF32(const int8_t from)
+{
+  return SoapySDR::S8toF32(from);
+}
+
+static inline float lutPartToF32(const uint8_t from)
+{
+  return SoapySDR::U8toF32(from);
+}
+
+template <typename Type>
+static const ComplexLUT *getComplexLUT(const double scaler)
+{
+  static std::mutex mutex;
+  static std::vector<std::unique_ptr<ComplexLUT>> tables;
+  static std::atomic<const ComplexLUT *> lastUsed(nullptr);
+
+  //the common case: the same scaler as the last call, without locking
+  const ComplexLUT *lut = lastUsed.load(std::memory_order_acquire);
+  if (lut != nullptr and lut->scaler == scaler) return lut;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const auto &table : tables)
+    {
+      if (table->scaler != scaler) continue;
+      lastUsed.store(table.get(), std::memory_order_release);
+      return table.get();
+    }
+  if (tables.size() >= LUT_MAX_TABLES) return nullptr;
+
+  std::unique_ptr<ComplexLUT> table(new ComplexLUT());
+  table->scaler = scaler;
+  for (size_t index = 0; index < (1 << 16); index++)
+    {
+      Type raw[2];
+      const uint16_t index16 = uint16_t(index);
+      std::memcpy(raw, &index16, sizeof(raw));
+      const float value[2] = {float(lutPartToF32(raw[0]) * scaler), float(lutPartToF32(raw[1]) * scaler)};
+      std::memcpy(&table->entries[index], value, sizeof(value));
+    }
+  tables.push_back(std::move(table));
+  lastUsed.store(tables.back().get(), std::memory_order_release);
+  return tables.back().get();
+}
+
+static void lutC8toCF32(const ComplexLUT *lut, const void *srcBuff, void *dstBuff, const size_t numElems)
+{
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      uint16_t index;
+      std::memcpy(&index, src+i*2, sizeof(index));
+      std::memcpy(dst+i*2, &lut->entries[index], sizeof(lut->entries[index]));
+    }
+}
+
+static void lutCS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const auto *lut = getComplexLUT<int8_t>(scaler);
+  if (lut == nullptr) genericCS8toCF32(srcBuff, dstBuff, numElems, scaler);
+  else lutC8toCF32(lut, srcBuff, dstBuff, numElems);
+}
+
+static void lutCU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const auto *lut = getComplexLUT<uint8_t>(scaler);
+  if (lut == nullptr) genericCU8toCF32(srcBuff, dstBuff, numElems, scaler);
+  else lutC8toCF32(lut, srcBuff, dstBuff, numElems);
+}
+
 // CS16 <> CU16
 static void genericCS16toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
@@ -641,6 +738,1572 @@ static void genericCU8toCS8(const void *srcBuff, void *dstBuff, const size_t num
     }
 }
 
+// 64-bit float and 32-bit integer Converters
+
+// F64 <> F64
+static void genericF64toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  if (scaler == 1.0)
+    {
+      const size_t sampleSize = sizeof(double);
+      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
+    }
+  else
+    {
+      auto *src = (double*)srcBuff;
+      auto *dst = (double*)dstBuff;
+      for (size_t i = 0; i < numElems*elemDepth; i++)
+        {
+          dst[i] = src[i] * scaler;
+        }
+    }
+}
+
+// U32 <> U32
+static void genericU32toU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  if (scaler == 1.0)
+    {
+      const size_t sampleSize = sizeof(uint32_t);
+      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
+    }
+  else
+    {
+      auto *src = (uint32_t*)srcBuff;
+      auto *dst = (uint32_t*)dstBuff;
+      for (size_t i = 0; i < numElems*elemDepth; i++)
+        {
+          dst[i] = src[i] * scaler;
+        }
+    }
+}
+
+// F64 <> F32
+static void genericF64toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = float(src[i] * scaler);
+    }
+}
+
+static void genericF32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = double(src[i]) * scaler;
+    }
+}
+
+// F64 <> S32
+static void genericF64toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F64toS32(src[i] * scaler);
+    }
+}
+
+static void genericS32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toF64(src[i]) * scaler;
+    }
+}
+
+// F64 <> U32
+static void genericF64toU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (uint32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toU32(SoapySDR::F64toS32(src[i] * scaler));
+    }
+}
+
+static void genericU32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint32_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toF64(SoapySDR::U32toS32(src[i])) * scaler;
+    }
+}
+
+// F64 <> S16
+static void genericF64toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F64toS16(src[i] * scaler);
+    }
+}
+
+static void genericS16toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toF64(src[i]) * scaler;
+    }
+}
+
+// F64 <> U16
+static void genericF64toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toU16(SoapySDR::F64toS16(src[i] * scaler));
+    }
+}
+
+static void genericU16toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toF64(SoapySDR::U16toS16(src[i])) * scaler;
+    }
+}
+
+// F64 <> S8
+static void genericF64toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F64toS8(src[i] * scaler);
+    }
+}
+
+static void genericS8toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toF64(src[i]) * scaler;
+    }
+}
+
+// F64 <> U8
+static void genericF64toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toU8(SoapySDR::F64toS8(src[i] * scaler));
+    }
+}
+
+static void genericU8toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toF64(SoapySDR::U8toS8(src[i])) * scaler;
+    }
+}
+
+// F32 <> S32
+static void genericF32toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toS32(src[i] * scaler);
+    }
+}
+
+static void genericS32toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toF32(src[i]) * scaler;
+    }
+}
+
+// F32 <> U32
+static void genericF32toU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toU32(src[i] * scaler);
+    }
+}
+
+static void genericU32toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint32_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::U32toF32(src[i]) * scaler;
+    }
+}
+
+// S32 <> S16
+static void genericS32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toS16(src[i] * scaler);
+    }
+}
+
+static void genericS16toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toS32(src[i]) * scaler;
+    }
+}
+
+// S32 <> U32
+static void genericS32toU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (uint32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toU32(src[i] * scaler);
+    }
+}
+
+static void genericU32toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint32_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::U32toS32(src[i]) * scaler;
+    }
+}
+
+// S32 <> S8
+static void genericS32toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toS8(src[i] * scaler);
+    }
+}
+
+static void genericS8toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toS32(src[i]) * scaler;
+    }
+}
+
+// S32 <> U8
+static void genericS32toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toU8(src[i] * scaler);
+    }
+}
+
+static void genericU8toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::U8toS32(src[i]) * scaler;
+    }
+}
+
+// S32 <> U16
+static void genericS32toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toU16(src[i] * scaler);
+    }
+}
+
+static void genericU16toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::U16toS32(src[i]) * scaler;
+    }
+}
+
+// CF64 <> CF64
+static void genericCF64toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0)
+    {
+      const size_t sampleSize = sizeof(double);
+      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
+    }
+  else
+    {
+      auto *src = (double*)srcBuff;
+      auto *dst = (double*)dstBuff;
+      for (size_t i = 0; i < numElems*elemDepth; i++)
+        {
+          dst[i] = src[i] * scaler;
+        }
+    }
+}
+
+// CU32 <> CU32
+static void genericCU32toCU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0)
+    {
+      const size_t sampleSize = sizeof(uint32_t);
+      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
+    }
+  else
+    {
+      auto *src = (uint32_t*)srcBuff;
+      auto *dst = (uint32_t*)dstBuff;
+      for (size_t i = 0; i < numElems*elemDepth; i++)
+        {
+          dst[i] = src[i] * scaler;
+        }
+    }
+}
+
+// CF64 <> CF32
+static void genericCF64toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = float(src[i] * scaler);
+    }
+}
+
+static void genericCF32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = double(src[i]) * scaler;
+    }
+}
+
+// CF64 <> CS32
+static void genericCF64toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F64toS32(src[i] * scaler);
+    }
+}
+
+static void genericCS32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toF64(src[i]) * scaler;
+    }
+}
+
+// CF64 <> CU32
+static void genericCF64toCU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (uint32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toU32(SoapySDR::F64toS32(src[i] * scaler));
+    }
+}
+
+static void genericCU32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint32_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toF64(SoapySDR::U32toS32(src[i])) * scaler;
+    }
+}
+
+// CF64 <> CS16
+static void genericCF64toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F64toS16(src[i] * scaler);
+    }
+}
+
+static void genericCS16toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toF64(src[i]) * scaler;
+    }
+}
+
+// CF64 <> CU16
+static void genericCF64toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toU16(SoapySDR::F64toS16(src[i] * scaler));
+    }
+}
+
+static void genericCU16toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toF64(SoapySDR::U16toS16(src[i])) * scaler;
+    }
+}
+
+// CF64 <> CS8
+static void genericCF64toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F64toS8(src[i] * scaler);
+    }
+}
+
+static void genericCS8toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toF64(src[i]) * scaler;
+    }
+}
+
+// CF64 <> CU8
+static void genericCF64toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (double*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toU8(SoapySDR::F64toS8(src[i] * scaler));
+    }
+}
+
+static void genericCU8toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toF64(SoapySDR::U8toS8(src[i])) * scaler;
+    }
+}
+
+// CF32 <> CS32
+static void genericCF32toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toS32(src[i] * scaler);
+    }
+}
+
+static void genericCS32toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toF32(src[i]) * scaler;
+    }
+}
+
+// CF32 <> CU32
+static void genericCF32toCU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toU32(src[i] * scaler);
+    }
+}
+
+static void genericCU32toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint32_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::U32toF32(src[i]) * scaler;
+    }
+}
+
+// CS32 <> CS16
+static void genericCS32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toS16(src[i] * scaler);
+    }
+}
+
+static void genericCS16toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toS32(src[i]) * scaler;
+    }
+}
+
+// CS32 <> CU32
+static void genericCS32toCU32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (uint32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toU32(src[i] * scaler);
+    }
+}
+
+static void genericCU32toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint32_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::U32toS32(src[i]) * scaler;
+    }
+}
+
+// CS32 <> CS8
+static void genericCS32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toS8(src[i] * scaler);
+    }
+}
+
+static void genericCS8toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toS32(src[i]) * scaler;
+    }
+}
+
+// CS32 <> CU8
+static void genericCS32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toU8(src[i] * scaler);
+    }
+}
+
+static void genericCU8toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::U8toS32(src[i]) * scaler;
+    }
+}
+
+// CS32 <> CU16
+static void genericCS32toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int32_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S32toU16(src[i] * scaler);
+    }
+}
+
+static void genericCU16toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::U16toS32(src[i]) * scaler;
+    }
+}
+
+// 16-bit float Converters
+
+// F16 <> F16
+static void genericF16toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  if (scaler == 1.0)
+    {
+      const size_t sampleSize = sizeof(uint16_t);
+      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
+    }
+  else
+    {
+      auto *src = (uint16_t*)srcBuff;
+      auto *dst = (uint16_t*)dstBuff;
+      for (size_t i = 0; i < numElems*elemDepth; i++)
+        {
+          dst[i] = SoapySDR::F32toF16(SoapySDR::F16toF32(src[i]) * scaler);
+        }
+    }
+}
+
+// F16 <> F32
+static void genericF16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F16toF32(src[i]) * scaler;
+    }
+}
+
+static void genericF32toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toF16(src[i] * scaler);
+    }
+}
+
+// F16 <> S16
+static void genericF16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toS16(SoapySDR::F16toF32(src[i]) * scaler);
+    }
+}
+
+static void genericS16toF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toF16(SoapySDR::S16toF32(src[i]) * scaler);
+    }
+}
+
+// CF16 <> CF16
+static void genericCF16toCF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  if (scaler == 1.0)
+    {
+      const size_t sampleSize = sizeof(uint16_t);
+      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
+    }
+  else
+    {
+      auto *src = (uint16_t*)srcBuff;
+      auto *dst = (uint16_t*)dstBuff;
+      for (size_t i = 0; i < numElems*elemDepth; i++)
+        {
+          dst[i] = SoapySDR::F32toF16(SoapySDR::F16toF32(src[i]) * scaler);
+        }
+    }
+}
+
+// CF16 <> CF32
+static void genericCF16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F16toF32(src[i]) * scaler;
+    }
+}
+
+static void genericCF32toCF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toF16(src[i] * scaler);
+    }
+}
+
+// CF16 <> CS16
+static void genericCF16toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toS16(SoapySDR::F16toF32(src[i]) * scaler);
+    }
+}
+
+static void genericCS16toCF16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toF16(SoapySDR::S16toF32(src[i]) * scaler);
+    }
+}
+
+// Wire format Converters
+//
+// The _BE formats hold big endian parts, swapped on little endian hosts,
+// the _QI formats swap the parts of each element.
+
+// CS16_BE <> CF32
+static void genericCS16BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toF32(SoapySDR::S16BEtoS16(src[i])) * scaler;
+    }
+}
+
+static void genericCF32toCS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toS16BE(SoapySDR::F32toS16(src[i] * scaler));
+    }
+}
+
+// CS16_BE <> CS16
+static void genericCS16BEtoCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16BEtoS16(src[i]) * scaler;
+    }
+}
+
+static void genericCS16toCS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toS16BE(int16_t(src[i] * scaler));
+    }
+}
+
+// CS16_QI <> CF32
+static void genericCS16QItoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toF32(src[i^1]) * scaler;
+    }
+}
+
+static void genericCF32toCS16QI(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toS16(src[i^1] * scaler);
+    }
+}
+
+// CS16_QI <> CS16
+static void genericCS16QItoCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = src[i^1] * scaler;
+    }
+}
+
+static void genericCS16toCS16QI(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = src[i^1] * scaler;
+    }
+}
+
+// CS8_QI <> CF32
+static void genericCS8QItoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S8toF32(src[i^1]) * scaler;
+    }
+}
+
+static void genericCF32toCS8QI(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toS8(src[i^1] * scaler);
+    }
+}
+
+// CS8_QI <> CS8
+static void genericCS8QItoCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = src[i^1] * scaler;
+    }
+}
+
+static void genericCS8toCS8QI(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = src[i^1] * scaler;
+    }
+}
+
+// CF32_BE <> CF32
+static void genericCF32BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint32_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32BEtoF32(src[i]) * scaler;
+    }
+}
+
+static void genericCF32toCF32BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toF32BE(float(src[i] * scaler));
+    }
+}
+
+// S16_BE <> F32
+static void genericS16BEtoF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toF32(SoapySDR::S16BEtoS16(src[i])) * scaler;
+    }
+}
+
+static void genericF32toS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toS16BE(SoapySDR::F32toS16(src[i] * scaler));
+    }
+}
+
+// S16_BE <> S16
+static void genericS16BEtoS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16BEtoS16(src[i]) * scaler;
+    }
+}
+
+static void genericS16toS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::S16toS16BE(int16_t(src[i] * scaler));
+    }
+}
+
+// F32_BE <> F32
+static void genericF32BEtoF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (uint32_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32BEtoF32(src[i]) * scaler;
+    }
+}
+
+static void genericF32toF32BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 1;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint32_t*)dstBuff;
+  for (size_t i = 0; i < numElems*elemDepth; i++)
+    {
+      dst[i] = SoapySDR::F32toF32BE(float(src[i] * scaler));
+    }
+}
+
+// Planar Converters
+//
+// The _PLANAR buffer is an array of 2 plane pointers (I, Q).
+
+// CF32 <> CF32_PLANAR
+static void genericCF32toCF32Planar(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (float*)srcBuff;
+  auto *dstI = ((float**)dstBuff)[0];
+  auto *dstQ = ((float**)dstBuff)[1];
+  for (size_t i = 0; i < numElems; i++)
+    {
+      dstI[i] = src[i*2+0] * scaler;
+      dstQ[i] = src[i*2+1] * scaler;
+    }
+}
+
+static void genericCF32PlanartoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *srcI = ((float**)srcBuff)[0];
+  auto *srcQ = ((float**)srcBuff)[1];
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      dst[i*2+0] = srcI[i] * scaler;
+      dst[i*2+1] = srcQ[i] * scaler;
+    }
+}
+
+// CS16 <> CF32_PLANAR
+static void genericCS16toCF32Planar(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (int16_t*)srcBuff;
+  auto *dstI = ((float**)dstBuff)[0];
+  auto *dstQ = ((float**)dstBuff)[1];
+  for (size_t i = 0; i < numElems; i++)
+    {
+      dstI[i] = SoapySDR::S16toF32(src[i*2+0]) * scaler;
+      dstQ[i] = SoapySDR::S16toF32(src[i*2+1]) * scaler;
+    }
+}
+
+static void genericCF32PlanartoCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *srcI = ((float**)srcBuff)[0];
+  auto *srcQ = ((float**)srcBuff)[1];
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      dst[i*2+0] = SoapySDR::F32toS16(srcI[i] * scaler);
+      dst[i*2+1] = SoapySDR::F32toS16(srcQ[i] * scaler);
+    }
+}
+
+// CS8 <> CF32_PLANAR
+static void genericCS8toCF32Planar(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *src = (int8_t*)srcBuff;
+  auto *dstI = ((float**)dstBuff)[0];
+  auto *dstQ = ((float**)dstBuff)[1];
+  for (size_t i = 0; i < numElems; i++)
+    {
+      dstI[i] = SoapySDR::S8toF32(src[i*2+0]) * scaler;
+      dstQ[i] = SoapySDR::S8toF32(src[i*2+1]) * scaler;
+    }
+}
+
+static void genericCF32PlanartoCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  auto *srcI = ((float**)srcBuff)[0];
+  auto *srcQ = ((float**)srcBuff)[1];
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      dst[i*2+0] = SoapySDR::F32toS8(srcI[i] * scaler);
+      dst[i*2+1] = SoapySDR::F32toS8(srcQ[i] * scaler);
+    }
+}
+
+// Packed Converters
+
+// CS12 <> CS16
+static void genericCS12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int16_t I, Q;
+      SoapySDR::CS12toCS16(src+i*3, I, Q);
+      dst[i*elemDepth+0] = I * scaler;
+      dst[i*elemDepth+1] = Q * scaler;
+    }
+}
+
+static void genericCS16toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int16_t I = src[i*elemDepth+0] * scaler;
+      const int16_t Q = src[i*elemDepth+1] * scaler;
+      SoapySDR::CS16toCS12(I, Q, dst+i*3);
+    }
+}
+
+// CS12 <> CF32
+static void genericCS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int16_t I, Q;
+      SoapySDR::CS12toCS16(src+i*3, I, Q);
+      dst[i*elemDepth+0] = SoapySDR::S16toF32(I) * scaler;
+      dst[i*elemDepth+1] = SoapySDR::S16toF32(Q) * scaler;
+    }
+}
+
+static void genericCF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int16_t I = SoapySDR::F32toS16(src[i*elemDepth+0] * scaler);
+      const int16_t Q = SoapySDR::F32toS16(src[i*elemDepth+1] * scaler);
+      SoapySDR::CS16toCS12(I, Q, dst+i*3);
+    }
+}
+
+// CU12 <> CU16
+static void genericCU12toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int16_t I, Q;
+      SoapySDR::CS12toCS16(src+i*3, I, Q);
+      dst[i*elemDepth+0] = uint16_t(I) * scaler;
+      dst[i*elemDepth+1] = uint16_t(Q) * scaler;
+    }
+}
+
+static void genericCU16toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const uint16_t I = src[i*elemDepth+0] * scaler;
+      const uint16_t Q = src[i*elemDepth+1] * scaler;
+      SoapySDR::CS16toCS12(int16_t(I), int16_t(Q), dst+i*3);
+    }
+}
+
+// CU12 <> CF32
+static void genericCU12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int16_t I, Q;
+      SoapySDR::CS12toCS16(src+i*3, I, Q);
+      dst[i*elemDepth+0] = SoapySDR::U16toF32(uint16_t(I)) * scaler;
+      dst[i*elemDepth+1] = SoapySDR::U16toF32(uint16_t(Q)) * scaler;
+    }
+}
+
+static void genericCF32toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const uint16_t I = SoapySDR::F32toU16(src[i*elemDepth+0] * scaler);
+      const uint16_t Q = SoapySDR::F32toU16(src[i*elemDepth+1] * scaler);
+      SoapySDR::CS16toCS12(int16_t(I), int16_t(Q), dst+i*3);
+    }
+}
+
+// CS4 <> CS8
+static void genericCS4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(src[i], I, Q);
+      dst[i*elemDepth+0] = I * scaler;
+      dst[i*elemDepth+1] = Q * scaler;
+    }
+}
+
+static void genericCS8toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int8_t I = int8_t(src[i*elemDepth+0] * scaler);
+      const int8_t Q = int8_t(src[i*elemDepth+1] * scaler);
+      dst[i] = SoapySDR::CS8toCS4(I, Q);
+    }
+}
+
+// CS4 <> CS16
+static void genericCS4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(src[i], I, Q);
+      dst[i*elemDepth+0] = SoapySDR::S8toS16(I) * scaler;
+      dst[i*elemDepth+1] = SoapySDR::S8toS16(Q) * scaler;
+    }
+}
+
+static void genericCS16toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int8_t I = SoapySDR::S16toS8(src[i*elemDepth+0] * scaler);
+      const int8_t Q = SoapySDR::S16toS8(src[i*elemDepth+1] * scaler);
+      dst[i] = SoapySDR::CS8toCS4(I, Q);
+    }
+}
+
+// CS4 <> CF32
+static void genericCS4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(src[i], I, Q);
+      dst[i*elemDepth+0] = SoapySDR::S8toF32(I) * scaler;
+      dst[i*elemDepth+1] = SoapySDR::S8toF32(Q) * scaler;
+    }
+}
+
+static void genericCF32toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int8_t I = SoapySDR::F32toS8(src[i*elemDepth+0] * scaler);
+      const int8_t Q = SoapySDR::F32toS8(src[i*elemDepth+1] * scaler);
+      dst[i] = SoapySDR::CS8toCS4(I, Q);
+    }
+}
+
+// CU4 <> CS8
+static void genericCU4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(uint8_t(src[i] ^ SoapySDR::U4_ZERO_OFFSET), I, Q);
+      dst[i*elemDepth+0] = I * scaler;
+      dst[i*elemDepth+1] = Q * scaler;
+    }
+}
+
+static void genericCS8toCU4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int8_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int8_t I = int8_t(src[i*elemDepth+0] * scaler);
+      const int8_t Q = int8_t(src[i*elemDepth+1] * scaler);
+      dst[i] = uint8_t(SoapySDR::CS8toCS4(I, Q) ^ SoapySDR::U4_ZERO_OFFSET);
+    }
+}
+
+// CU4 <> CS16
+static void genericCU4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(uint8_t(src[i] ^ SoapySDR::U4_ZERO_OFFSET), I, Q);
+      dst[i*elemDepth+0] = SoapySDR::S8toS16(I) * scaler;
+      dst[i*elemDepth+1] = SoapySDR::S8toS16(Q) * scaler;
+    }
+}
+
+static void genericCS16toCU4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int8_t I = SoapySDR::S16toS8(src[i*elemDepth+0] * scaler);
+      const int8_t Q = SoapySDR::S16toS8(src[i*elemDepth+1] * scaler);
+      dst[i] = uint8_t(SoapySDR::CS8toCS4(I, Q) ^ SoapySDR::U4_ZERO_OFFSET);
+    }
+}
+
+// CU4 <> CF32
+static void genericCU4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      int8_t I, Q;
+      SoapySDR::CS4toCS8(uint8_t(src[i] ^ SoapySDR::U4_ZERO_OFFSET), I, Q);
+      dst[i*elemDepth+0] = SoapySDR::S8toF32(I) * scaler;
+      dst[i*elemDepth+1] = SoapySDR::S8toF32(Q) * scaler;
+    }
+}
+
+static void genericCF32toCU4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
+    {
+      const int8_t I = SoapySDR::F32toS8(src[i*elemDepth+0] * scaler);
+      const int8_t Q = SoapySDR::F32toS8(src[i*elemDepth+1] * scaler);
+      dst[i] = uint8_t(SoapySDR::CS8toCS4(I, Q) ^ SoapySDR::U4_ZERO_OFFSET);
+    }
+}
+
 /*!
  * lateLoadDefaultConverters() is called by loadModules()
  * to load the converters on-demand/not statically.
@@ -695,4 +2358,135 @@ void lateLoadDefaultConverters(void)
     static SoapySDR::ConverterRegistry registerGenericCS8toCU16(SOAPY_SDR_CS8, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCU16);
     static SoapySDR::ConverterRegistry registerGenericCS8toCU8(SOAPY_SDR_CS8, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCU8);
     static SoapySDR::ConverterRegistry registerGenericCU8toCS8(SOAPY_SDR_CU8, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCS8);
+    static SoapySDR::ConverterRegistry registerGenericCS12toCS16(SOAPY_SDR_CS12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS12toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS12(SOAPY_SDR_CS16, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS12);
+    static SoapySDR::ConverterRegistry registerGenericCS12toCF32(SOAPY_SDR_CS12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS12toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS12);
+    static SoapySDR::ConverterRegistry registerGenericCU12toCU16(SOAPY_SDR_CU12, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCU12toCU16);
+    static SoapySDR::ConverterRegistry registerGenericCU16toCU12(SOAPY_SDR_CU16, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCU12);
+    static SoapySDR::ConverterRegistry registerGenericCU12toCF32(SOAPY_SDR_CU12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU12toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCU12(SOAPY_SDR_CF32, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU12);
+    static SoapySDR::ConverterRegistry registerGenericCS4toCS8(SOAPY_SDR_CS4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS4toCS8);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCS4(SOAPY_SDR_CS8, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCS4);
+    static SoapySDR::ConverterRegistry registerGenericCS4toCS16(SOAPY_SDR_CS4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS4toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS4(SOAPY_SDR_CS16, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS4);
+    static SoapySDR::ConverterRegistry registerGenericCS4toCF32(SOAPY_SDR_CS4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS4toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS4(SOAPY_SDR_CF32, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS4);
+    static SoapySDR::ConverterRegistry registerGenericCU4toCS8(SOAPY_SDR_CU4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCU4toCS8);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCU4(SOAPY_SDR_CS8, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCU4);
+    static SoapySDR::ConverterRegistry registerGenericCU4toCS16(SOAPY_SDR_CU4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCU4toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCU4(SOAPY_SDR_CS16, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCU4);
+    static SoapySDR::ConverterRegistry registerGenericCU4toCF32(SOAPY_SDR_CU4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU4toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCU4(SOAPY_SDR_CF32, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU4);
+    static SoapySDR::ConverterRegistry registerGenericF64toF64(SOAPY_SDR_F64, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericF64toF64);
+    static SoapySDR::ConverterRegistry registerGenericU32toU32(SOAPY_SDR_U32, SOAPY_SDR_U32, SoapySDR::ConverterRegistry::GENERIC, &genericU32toU32);
+    static SoapySDR::ConverterRegistry registerGenericF64toF32(SOAPY_SDR_F64, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericF64toF32);
+    static SoapySDR::ConverterRegistry registerGenericF32toF64(SOAPY_SDR_F32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericF32toF64);
+    static SoapySDR::ConverterRegistry registerGenericF64toS32(SOAPY_SDR_F64, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericF64toS32);
+    static SoapySDR::ConverterRegistry registerGenericS32toF64(SOAPY_SDR_S32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericS32toF64);
+    static SoapySDR::ConverterRegistry registerGenericF64toU32(SOAPY_SDR_F64, SOAPY_SDR_U32, SoapySDR::ConverterRegistry::GENERIC, &genericF64toU32);
+    static SoapySDR::ConverterRegistry registerGenericU32toF64(SOAPY_SDR_U32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericU32toF64);
+    static SoapySDR::ConverterRegistry registerGenericF64toS16(SOAPY_SDR_F64, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericF64toS16);
+    static SoapySDR::ConverterRegistry registerGenericS16toF64(SOAPY_SDR_S16, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericS16toF64);
+    static SoapySDR::ConverterRegistry registerGenericF64toU16(SOAPY_SDR_F64, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericF64toU16);
+    static SoapySDR::ConverterRegistry registerGenericU16toF64(SOAPY_SDR_U16, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericU16toF64);
+    static SoapySDR::ConverterRegistry registerGenericF64toS8(SOAPY_SDR_F64, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericF64toS8);
+    static SoapySDR::ConverterRegistry registerGenericS8toF64(SOAPY_SDR_S8, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericS8toF64);
+    static SoapySDR::ConverterRegistry registerGenericF64toU8(SOAPY_SDR_F64, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericF64toU8);
+    static SoapySDR::ConverterRegistry registerGenericU8toF64(SOAPY_SDR_U8, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericU8toF64);
+    static SoapySDR::ConverterRegistry registerGenericF32toS32(SOAPY_SDR_F32, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericF32toS32);
+    static SoapySDR::ConverterRegistry registerGenericS32toF32(SOAPY_SDR_S32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericS32toF32);
+    static SoapySDR::ConverterRegistry registerGenericF32toU32(SOAPY_SDR_F32, SOAPY_SDR_U32, SoapySDR::ConverterRegistry::GENERIC, &genericF32toU32);
+    static SoapySDR::ConverterRegistry registerGenericU32toF32(SOAPY_SDR_U32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericU32toF32);
+    static SoapySDR::ConverterRegistry registerGenericS32toS16(SOAPY_SDR_S32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericS32toS16);
+    static SoapySDR::ConverterRegistry registerGenericS16toS32(SOAPY_SDR_S16, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericS16toS32);
+    static SoapySDR::ConverterRegistry registerGenericS32toU32(SOAPY_SDR_S32, SOAPY_SDR_U32, SoapySDR::ConverterRegistry::GENERIC, &genericS32toU32);
+    static SoapySDR::ConverterRegistry registerGenericU32toS32(SOAPY_SDR_U32, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericU32toS32);
+    static SoapySDR::ConverterRegistry registerGenericS32toS8(SOAPY_SDR_S32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericS32toS8);
+    static SoapySDR::ConverterRegistry registerGenericS8toS32(SOAPY_SDR_S8, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericS8toS32);
+    static SoapySDR::ConverterRegistry registerGenericS32toU8(SOAPY_SDR_S32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericS32toU8);
+    static SoapySDR::ConverterRegistry registerGenericU8toS32(SOAPY_SDR_U8, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericU8toS32);
+    static SoapySDR::ConverterRegistry registerGenericS32toU16(SOAPY_SDR_S32, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericS32toU16);
+    static SoapySDR::ConverterRegistry registerGenericU16toS32(SOAPY_SDR_U16, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericU16toS32);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCF64(SOAPY_SDR_CF64, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericCF64toCF64);
+    static SoapySDR::ConverterRegistry registerGenericCU32toCU32(SOAPY_SDR_CU32, SOAPY_SDR_CU32, SoapySDR::ConverterRegistry::GENERIC, &genericCU32toCU32);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCF32(SOAPY_SDR_CF64, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCF64toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCF64(SOAPY_SDR_CF32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCF64);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCS32(SOAPY_SDR_CF64, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCF64toCS32);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCF64(SOAPY_SDR_CS32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCF64);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCU32(SOAPY_SDR_CF64, SOAPY_SDR_CU32, SoapySDR::ConverterRegistry::GENERIC, &genericCF64toCU32);
+    static SoapySDR::ConverterRegistry registerGenericCU32toCF64(SOAPY_SDR_CU32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericCU32toCF64);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCS16(SOAPY_SDR_CF64, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCF64toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCF64(SOAPY_SDR_CS16, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCF64);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCU16(SOAPY_SDR_CF64, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCF64toCU16);
+    static SoapySDR::ConverterRegistry registerGenericCU16toCF64(SOAPY_SDR_CU16, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCF64);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCS8(SOAPY_SDR_CF64, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCF64toCS8);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCF64(SOAPY_SDR_CS8, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCF64);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCU8(SOAPY_SDR_CF64, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCF64toCU8);
+    static SoapySDR::ConverterRegistry registerGenericCU8toCF64(SOAPY_SDR_CU8, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCF64);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS32(SOAPY_SDR_CF32, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS32);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCF32(SOAPY_SDR_CS32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCU32(SOAPY_SDR_CF32, SOAPY_SDR_CU32, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU32);
+    static SoapySDR::ConverterRegistry registerGenericCU32toCF32(SOAPY_SDR_CU32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU32toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCS16(SOAPY_SDR_CS32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS32(SOAPY_SDR_CS16, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS32);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCU32(SOAPY_SDR_CS32, SOAPY_SDR_CU32, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCU32);
+    static SoapySDR::ConverterRegistry registerGenericCU32toCS32(SOAPY_SDR_CU32, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCU32toCS32);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCS8(SOAPY_SDR_CS32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCS8);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCS32(SOAPY_SDR_CS8, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCS32);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCU8(SOAPY_SDR_CS32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCU8);
+    static SoapySDR::ConverterRegistry registerGenericCU8toCS32(SOAPY_SDR_CU8, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCS32);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCU16(SOAPY_SDR_CS32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCU16);
+    static SoapySDR::ConverterRegistry registerGenericCU16toCS32(SOAPY_SDR_CU16, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCS32);
+    static SoapySDR::ConverterRegistry registerGenericF16toF16(SOAPY_SDR_F16, SOAPY_SDR_F16, SoapySDR::ConverterRegistry::GENERIC, &genericF16toF16);
+    static SoapySDR::ConverterRegistry registerGenericF16toF32(SOAPY_SDR_F16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericF16toF32);
+    static SoapySDR::ConverterRegistry registerGenericF32toF16(SOAPY_SDR_F32, SOAPY_SDR_F16, SoapySDR::ConverterRegistry::GENERIC, &genericF32toF16);
+    static SoapySDR::ConverterRegistry registerGenericF16toS16(SOAPY_SDR_F16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericF16toS16);
+    static SoapySDR::ConverterRegistry registerGenericS16toF16(SOAPY_SDR_S16, SOAPY_SDR_F16, SoapySDR::ConverterRegistry::GENERIC, &genericS16toF16);
+    static SoapySDR::ConverterRegistry registerGenericCF16toCF16(SOAPY_SDR_CF16, SOAPY_SDR_CF16, SoapySDR::ConverterRegistry::GENERIC, &genericCF16toCF16);
+    static SoapySDR::ConverterRegistry registerGenericCF16toCF32(SOAPY_SDR_CF16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCF16toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCF16(SOAPY_SDR_CF32, SOAPY_SDR_CF16, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCF16);
+    static SoapySDR::ConverterRegistry registerGenericCF16toCS16(SOAPY_SDR_CF16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCF16toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCF16(SOAPY_SDR_CS16, SOAPY_SDR_CF16, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCF16);
+    static SoapySDR::ConverterRegistry registerGenericCS16BEtoCF32(SOAPY_SDR_CS16_BE, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS16BEtoCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS16BE(SOAPY_SDR_CF32, SOAPY_SDR_CS16_BE, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS16BE);
+    static SoapySDR::ConverterRegistry registerGenericCS16BEtoCS16(SOAPY_SDR_CS16_BE, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS16BEtoCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS16BE(SOAPY_SDR_CS16, SOAPY_SDR_CS16_BE, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS16BE);
+    static SoapySDR::ConverterRegistry registerGenericCS16QItoCF32(SOAPY_SDR_CS16_QI, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS16QItoCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS16QI(SOAPY_SDR_CF32, SOAPY_SDR_CS16_QI, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS16QI);
+    static SoapySDR::ConverterRegistry registerGenericCS16QItoCS16(SOAPY_SDR_CS16_QI, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS16QItoCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS16QI(SOAPY_SDR_CS16, SOAPY_SDR_CS16_QI, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS16QI);
+    static SoapySDR::ConverterRegistry registerGenericCS8QItoCF32(SOAPY_SDR_CS8_QI, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS8QItoCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS8QI(SOAPY_SDR_CF32, SOAPY_SDR_CS8_QI, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS8QI);
+    static SoapySDR::ConverterRegistry registerGenericCS8QItoCS8(SOAPY_SDR_CS8_QI, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS8QItoCS8);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCS8QI(SOAPY_SDR_CS8, SOAPY_SDR_CS8_QI, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCS8QI);
+    static SoapySDR::ConverterRegistry registerGenericCF32BEtoCF32(SOAPY_SDR_CF32_BE, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCF32BEtoCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCF32BE(SOAPY_SDR_CF32, SOAPY_SDR_CF32_BE, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCF32BE);
+    static SoapySDR::ConverterRegistry registerGenericS16BEtoF32(SOAPY_SDR_S16_BE, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericS16BEtoF32);
+    static SoapySDR::ConverterRegistry registerGenericF32toS16BE(SOAPY_SDR_F32, SOAPY_SDR_S16_BE, SoapySDR::ConverterRegistry::GENERIC, &genericF32toS16BE);
+    static SoapySDR::ConverterRegistry registerGenericS16BEtoS16(SOAPY_SDR_S16_BE, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericS16BEtoS16);
+    static SoapySDR::ConverterRegistry registerGenericS16toS16BE(SOAPY_SDR_S16, SOAPY_SDR_S16_BE, SoapySDR::ConverterRegistry::GENERIC, &genericS16toS16BE);
+    static SoapySDR::ConverterRegistry registerGenericF32BEtoF32(SOAPY_SDR_F32_BE, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericF32BEtoF32);
+    static SoapySDR::ConverterRegistry registerGenericF32toF32BE(SOAPY_SDR_F32, SOAPY_SDR_F32_BE, SoapySDR::ConverterRegistry::GENERIC, &genericF32toF32BE);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCF32Planar(SOAPY_SDR_CF32, SOAPY_SDR_CF32_PLANAR, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCF32Planar);
+    static SoapySDR::ConverterRegistry registerGenericCF32PlanartoCF32(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCF32PlanartoCF32);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCF32Planar(SOAPY_SDR_CS16, SOAPY_SDR_CF32_PLANAR, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCF32Planar);
+    static SoapySDR::ConverterRegistry registerGenericCF32PlanartoCS16(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCF32PlanartoCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCF32Planar(SOAPY_SDR_CS8, SOAPY_SDR_CF32_PLANAR, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCF32Planar);
+    static SoapySDR::ConverterRegistry registerGenericCF32PlanartoCS8(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCF32PlanartoCS8);
+
+    //the lookup table converters take the generic instruction set of VECTORIZED,
+    //they are used where no SIMD kernel is available or selected
+    static SoapySDR::ConverterRegistry registerLUTCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &lutCS8toCF32, SoapySDR::ConverterRegistry::ISA_GENERIC);
+    static SoapySDR::ConverterRegistry registerLUTCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::VECTORIZED, &lutCU8toCF32, SoapySDR::ConverterRegistry::ISA_GENERIC);
+
+    //the vectorized converters share the VECTORIZED priority,
+    //the registry selects the instruction set supported by the CPU
+    lateLoadSSE2Converters();
+    lateLoadSSE41Converters();
+    lateLoadAVX2Converters();
+    lateLoadAVX512Converters();
+
+    //the dithered converters are stateful and only selected by priority
+    lateLoadDitherConverters();
 }
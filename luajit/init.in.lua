@@ -95,6 +95,7 @@ local SoapySDR =
     --
     -- @field CF64 LuaJIT type "complex"
     -- @field CF32 LuaJIT type "complex float"
+    -- @field CF16 complex half precision float (no native LuaJIT type)
     -- @field CS32 complex int32_t (no native LuaJIT type)
     -- @field CU32 complex uint32_t (no native LuaJIT type)
     -- @field CS16 complex int16_t (no native LuaJIT type)
@@ -107,6 +108,7 @@ local SoapySDR =
     -- @field CU4 complex uint4_t (usually over-the-wire)
     -- @field F64 double
     -- @field F32 float
+    -- @field F16 half precision float (no native LuaJIT type)
     -- @field S32 int32_t
     -- @field U32 uint32_t
     -- @field S16 int16_t
@@ -119,6 +121,7 @@ local SoapySDR =
     {
         CF64 = "CF64",
         CF32 = "CF32",
+        CF16 = "CF16",
         CS32 = "CS32",
         CU32 = "CU32",
         CS16 = "CS16",
@@ -132,6 +135,7 @@ local SoapySDR =
 
         F64 = "F64",
         F32 = "F32",
+        F16 = "F16",
         S32 = "S32",
         U32 = "U32",
         S16 = "S16",
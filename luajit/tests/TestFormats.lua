@@ -12,6 +12,7 @@ function testFormatSizes()
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.S16), 2)
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.U32), 4)
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.S32), 4)
+    luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.F16), 2)
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.F32), 4)
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.F64), 8)
 
@@ -25,6 +26,7 @@ function testFormatSizes()
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.CS16), 4)
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.CU32), 8)
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.CS32), 8)
+    luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.CF16), 4)
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.CF32), 8)
     luaunit.assertEquals(SoapySDR.Format.ToSize(SoapySDR.Format.CF64), 16)
 end
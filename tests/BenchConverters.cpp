@@ -0,0 +1,216 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+// Converter throughput benchmark.
+//
+// Times every registered converter function: each source and target format,
+// priority, and instruction set supported by this CPU, at sizes from 256 to 4M
+// elements, with cache line aligned and misaligned buffers.
+// The results are written as JSON for comparison between builds and releases.
+//
+// Usage: BenchConverters [--min-size=256] [--max-size=4194304] [--min-time=0.01] [--output=file.json]
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Version.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <vector>
+
+static const size_t ALIGNMENT = 64;
+
+//offset of a misaligned buffer: aligned for any part type, but not for vector loads
+static const size_t MISALIGNMENT = 8;
+
+static const char *isaName(const SoapySDR::ConverterRegistry::InstructionSet isa)
+{
+    switch (isa)
+    {
+    case SoapySDR::ConverterRegistry::ISA_GENERIC: return "generic";
+    case SoapySDR::ConverterRegistry::ISA_SSE2: return "sse2";
+    case SoapySDR::ConverterRegistry::ISA_SSE41: return "sse4.1";
+    case SoapySDR::ConverterRegistry::ISA_AVX2: return "avx2";
+    case SoapySDR::ConverterRegistry::ISA_AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+static bool isPlanar(const std::string &format)
+{
+    return format.find("_PLANAR") != std::string::npos;
+}
+
+/***********************************************************************
+ * A buffer in a format, one or two planes at a given alignment
+ **********************************************************************/
+struct BenchBuffer
+{
+    BenchBuffer(const std::string &format, const size_t numElems, const size_t offset):
+        planar(isPlanar(format)),
+        size(SoapySDR::formatToSize(format)*numElems)
+    {
+        const size_t numPlanes = planar?2:1;
+        for (size_t i = 0; i < numPlanes; i++)
+        {
+            mem[i].resize(size/numPlanes + ALIGNMENT + offset);
+            const size_t misalign = size_t(mem[i].data()) % ALIGNMENT;
+            planes[i] = mem[i].data() + (misalign?ALIGNMENT-misalign:0) + offset;
+        }
+    }
+
+    void *get(void)
+    {
+        return planar?(void *)planes:planes[0];
+    }
+
+    //fill floats with values in range, and any other format with random bytes
+    void fill(const std::string &format)
+    {
+        const size_t numPlanes = planar?2:1;
+        const bool isFloat = (format[0] == 'F' or format.compare(0, 2, "CF") == 0);
+        const size_t partSize = SoapySDR::formatToSize(format)/((format[0] == 'C')?2:1);
+        for (size_t p = 0; p < numPlanes; p++)
+        {
+            uint8_t *buff = planes[p];
+            if (not isFloat)
+            {
+                for (size_t i = 0; i < size/numPlanes; i++) buff[i] = uint8_t(std::rand());
+                continue;
+            }
+            for (size_t i = 0; i < size/numPlanes/partSize; i++)
+            {
+                const float value = (std::rand()/float(RAND_MAX))*2 - 1;
+                if (partSize == 2)
+                {
+                    const uint16_t half = SoapySDR::F32toF16(value);
+                    std::memcpy(buff + i*2, &half, 2);
+                }
+                else if (partSize == 4) std::memcpy(buff + i*4, &value, 4);
+                else
+                {
+                    const double dbl = value;
+                    std::memcpy(buff + i*8, &dbl, 8);
+                }
+            }
+        }
+    }
+
+    bool planar;
+    size_t size;
+    std::vector<uint8_t> mem[2];
+    uint8_t *planes[2];
+};
+
+/***********************************************************************
+ * Time one function at one size: repeat until the minimum time elapses
+ **********************************************************************/
+static double benchElemsPerSec(
+    SoapySDR::ConverterRegistry::ConverterFunction function,
+    void *src, void *dst, const size_t numElems, const double minTime)
+{
+    function(src, dst, numElems, 1.0); //warm up the caches and any lazy tables
+
+    size_t numCalls = 0;
+    double elapsed = 0.0;
+    const auto start = std::chrono::high_resolution_clock::now();
+    do
+    {
+        function(src, dst, numElems, 1.0);
+        numCalls++;
+        elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    } while (elapsed < minTime);
+
+    return (elapsed > 0.0)?(numCalls*numElems)/elapsed:0.0;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t minSize = 256;
+    size_t maxSize = 4*1024*1024;
+    double minTime = 0.01;
+    std::string outputPath;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        const auto eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = (eq == std::string::npos)?"":arg.substr(eq+1);
+        if (key == "--min-size") minSize = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "--max-size") maxSize = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "--min-time") minTime = std::strtod(value.c_str(), nullptr);
+        else if (key == "--output") outputPath = value;
+        else
+        {
+            fprintf(stderr, "Usage: %s [--min-size=256] [--max-size=4194304] [--min-time=0.01] [--output=file.json]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    FILE *out = outputPath.empty()?stdout:fopen(outputPath.c_str(), "w");
+    if (out == nullptr)
+    {
+        fprintf(stderr, "Cannot open %s\n", outputPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    const auto cpuIsa = SoapySDR::ConverterRegistry::getInstructionSet();
+    fprintf(out, "{\n");
+    fprintf(out, "  \"libVersion\": \"%s\",\n", SoapySDR::getLibVersion().c_str());
+    fprintf(out, "  \"instructionSet\": \"%s\",\n", isaName(cpuIsa));
+    fprintf(out, "  \"minTime\": %g,\n", minTime);
+    fprintf(out, "  \"results\": [");
+
+    size_t numResults = 0;
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            const size_t srcElemSize = SoapySDR::formatToSize(source);
+            const size_t dstElemSize = SoapySDR::formatToSize(target);
+            if (srcElemSize == 0 or dstElemSize == 0) continue;
+
+            //buffers are filled once per pair and shared by all of its functions
+            const size_t offsets[2] = {0, MISALIGNMENT};
+            std::vector<BenchBuffer> srcs, dsts;
+            srcs.reserve(2);
+            dsts.reserve(2);
+            for (const size_t offset : offsets)
+            {
+                srcs.emplace_back(source, maxSize, offset);
+                dsts.emplace_back(target, maxSize, offset);
+                srcs.back().fill(source);
+            }
+
+            for (const auto &priority : SoapySDR::ConverterRegistry::listPriorities(source, target))
+            {
+                for (const auto &isa : SoapySDR::ConverterRegistry::listInstructionSets(source, target, priority))
+                {
+                    if (isa > cpuIsa) continue;
+                    const auto function = SoapySDR::ConverterRegistry::getFunction(source, target, priority, isa);
+
+                    for (size_t i = 0; i < 2; i++)
+                    {
+                        for (size_t numElems = minSize; numElems <= maxSize; numElems *= 4)
+                        {
+                            const double elemsPerSec = benchElemsPerSec(function, srcs[i].get(), dsts[i].get(), numElems, minTime);
+                            fprintf(out, "%s\n    {\"source\": \"%s\", \"target\": \"%s\", \"priority\": %d, \"instructionSet\": \"%s\", "
+                                "\"aligned\": %s, \"elements\": %zu, \"elementsPerSec\": %.6g, \"gigabytesPerSec\": %.6g}",
+                                (numResults++ == 0)?"":",", source.c_str(), target.c_str(), int(priority), isaName(isa),
+                                (offsets[i] == 0)?"true":"false", numElems, elemsPerSec, elemsPerSec*(srcElemSize+dstElemSize)/1e9);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+    if (out != stdout) fclose(out);
+    fprintf(stderr, "Benchmarked %zu converter configurations\n", numResults);
+    return EXIT_SUCCESS;
+}
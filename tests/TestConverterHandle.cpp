@@ -0,0 +1,700 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Converters.h>
+#include <SoapySDR/Device.h>
+#include <SoapySDR/Formats.hpp>
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#define check_true(x) \
+    printf("  Check %s ... ", #x); \
+    if (not (x)) \
+    { \
+        printf("FAIL\n"); \
+        return EXIT_FAILURE; \
+    } \
+    else printf("PASS\n")
+
+//more than one chunk of the internal staging, and not a multiple of a vector
+static const size_t NUM_ELEMS = 5003;
+
+static std::vector<std::complex<float>> randomCF32(const size_t numElems)
+{
+    std::vector<std::complex<float>> out(numElems);
+    for (auto &x : out) x = std::complex<float>(std::rand()/float(RAND_MAX) - 0.5f, std::rand()/float(RAND_MAX) - 0.5f);
+    return out;
+}
+
+static float maxError(const std::vector<std::complex<float>> &a, const std::vector<std::complex<float>> &b)
+{
+    float error = 0.0f;
+    for (size_t i = 0; i < std::min(a.size(), b.size()); i++) error = std::max(error, std::abs(a[i] - b[i]));
+    return error;
+}
+
+/***********************************************************************
+ * Complex scaler
+ **********************************************************************/
+static int testComplexScaler(void)
+{
+    printf("Check complex scaler:\n");
+    const std::complex<double> scaler(0.3, -0.4);
+    const auto in = randomCF32(NUM_ELEMS);
+    std::vector<std::complex<float>> expected(NUM_ELEMS), out(NUM_ELEMS);
+    for (size_t i = 0; i < NUM_ELEMS; i++) expected[i] = in[i]*std::complex<float>(scaler);
+
+    //CF32 source: rotate, then convert
+    std::vector<int16_t> cs16(NUM_ELEMS*2);
+    SoapySDR::Converter toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16);
+    toCS16.convert(in.data(), cs16.data(), NUM_ELEMS, scaler);
+    SoapySDR::Converter(SOAPY_SDR_CS16, SOAPY_SDR_CF32).convert(cs16.data(), out.data(), NUM_ELEMS);
+    check_true(maxError(out, expected) < 1e-4f);
+
+    //CF32 target: convert, then rotate
+    SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16).convert(in.data(), cs16.data(), NUM_ELEMS);
+    SoapySDR::Converter(SOAPY_SDR_CS16, SOAPY_SDR_CF32).convert(cs16.data(), out.data(), NUM_ELEMS, scaler);
+    check_true(maxError(out, expected) < 1e-4f);
+
+    //CF32 to CF32 and a real valued scaler
+    SoapySDR::Converter copy(SOAPY_SDR_CF32, SOAPY_SDR_CF32);
+    copy.convert(in.data(), out.data(), NUM_ELEMS, scaler);
+    check_true(maxError(out, expected) < 1e-6f);
+    copy.convert(in.data(), out.data(), NUM_ELEMS, std::complex<double>(1.0, 0.0));
+    check_true(maxError(out, in) == 0.0f);
+
+    //planar source and target, each plane offset per chunk
+    std::vector<float> planeI(NUM_ELEMS), planeQ(NUM_ELEMS);
+    void *planes[2] = {planeI.data(), planeQ.data()};
+    SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CF32_PLANAR).convert(in.data(), planes, NUM_ELEMS, scaler);
+    for (size_t i = 0; i < NUM_ELEMS; i++) out[i] = std::complex<float>(planeI[i], planeQ[i]);
+    check_true(maxError(out, expected) < 1e-6f);
+    SoapySDR::Converter(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CF32).convert(planes, out.data(), NUM_ELEMS, std::complex<double>(0.0, 1.0));
+    for (size_t i = 0; i < NUM_ELEMS; i++) expected[i] *= std::complex<float>(0.0f, 1.0f);
+    check_true(maxError(out, expected) < 1e-6f);
+
+    //without a CF32 side, also for a real valued scaler
+    for (const auto &badScaler : {scaler, std::complex<double>(1.0, 0.0)})
+    {
+        bool threw = false;
+        try
+        {
+            SoapySDR::Converter(SOAPY_SDR_CS16, SOAPY_SDR_CS8).convert(cs16.data(), out.data(), NUM_ELEMS, badScaler);
+        }
+        catch (const std::runtime_error &)
+        {
+            threw = true;
+        }
+        check_true(threw);
+    }
+    return EXIT_SUCCESS;
+}
+
+template <typename Fn>
+static bool throwsOnCreate(const Fn &create)
+{
+    try
+    {
+        create();
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+/***********************************************************************
+ * Path chaining
+ **********************************************************************/
+static int testPathChaining(void)
+{
+    printf("Check path chaining:\n");
+
+    //every path starts and ends with its formats, with registered hops between sized formats
+    std::vector<std::string> formats = SoapySDR::ConverterRegistry::listAvailableSourceFormats();
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source)) formats.push_back(target);
+    }
+    std::sort(formats.begin(), formats.end());
+    formats.erase(std::unique(formats.begin(), formats.end()), formats.end());
+    size_t numPaths = 0, numBad = 0;
+    for (const auto &source : formats)
+    {
+        for (const auto &target : formats)
+        {
+            const auto path = SoapySDR::ConverterRegistry::findPath(source, target);
+            if (path.empty()) continue;
+            numPaths++;
+            if (path.size() < 2 or path.size() > 4 or path.front() != source or path.back() != target) numBad++;
+            for (size_t hop = 0; hop+1 < path.size(); hop++)
+            {
+                if (SoapySDR::ConverterRegistry::listPriorities(path[hop], path[hop+1]).empty()) numBad++;
+                if (hop != 0 and (path[hop].find("_PLANAR") != std::string::npos or SoapySDR::formatToSize(path[hop]) == 0)) numBad++;
+            }
+        }
+    }
+    check_true(numPaths > formats.size());
+    check_true(numBad == 0);
+
+    //a direct conversion is a path of one hop
+    check_true(SoapySDR::ConverterRegistry::findPath(SOAPY_SDR_CF32, SOAPY_SDR_CS16) == std::vector<std::string>({SOAPY_SDR_CF32, SOAPY_SDR_CS16}));
+    check_true(SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16).getFunction() != nullptr);
+
+    //chained conversions match the hops converted one after another, with the scaler applied once
+    const auto in = randomCF32(NUM_ELEMS);
+    for (const auto &pair : {std::make_pair(SOAPY_SDR_CS12, SOAPY_SDR_CS8), std::make_pair(SOAPY_SDR_CS16, SOAPY_SDR_CU32), std::make_pair(SOAPY_SDR_CF16, SOAPY_SDR_CS8)})
+    {
+        printf("  %s to %s:\n", pair.first, pair.second);
+        const auto path = SoapySDR::ConverterRegistry::findPath(pair.first, pair.second);
+        check_true(path.size() == 3);
+        SoapySDR::Converter chained(pair.first, pair.second);
+        check_true(chained.isValid());
+        check_true(chained.getFunction() == nullptr);
+        check_true(chained.getPath() == path);
+
+        std::vector<uint8_t> src(NUM_ELEMS*chained.getSourceElementSize());
+        SoapySDR::Converter(SOAPY_SDR_CF32, pair.first).convert(in.data(), src.data(), NUM_ELEMS);
+        std::vector<uint8_t> out(NUM_ELEMS*chained.getTargetElementSize());
+        chained.convert(src.data(), out.data(), NUM_ELEMS, 0.5);
+
+        //the first hop of these paths is from or to a float format
+        SoapySDR::Converter first(path[0], path[1]), second(path[1], path[2]);
+        check_true(chained.getPriority() == std::min(first.getPriority(), second.getPriority()));
+        std::vector<uint8_t> staging(NUM_ELEMS*first.getTargetElementSize()), expected(out.size());
+        first.convert(src.data(), staging.data(), NUM_ELEMS, 0.5);
+        second.convert(staging.data(), expected.data(), NUM_ELEMS);
+        check_true(out == expected);
+
+        //and the result is the scaled input, within the resolution of the narrowest format
+        std::vector<std::complex<float>> result(NUM_ELEMS), scaled(NUM_ELEMS);
+        SoapySDR::Converter(pair.second, SOAPY_SDR_CF32).convert(out.data(), result.data(), NUM_ELEMS);
+        for (size_t i = 0; i < NUM_ELEMS; i++) scaled[i] = in[i]*0.5f;
+        check_true(maxError(result, scaled) < 0.02f);
+    }
+
+    //planar formats are only converted directly, and a priority never chains
+    check_true(SoapySDR::ConverterRegistry::findPath(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CS12).empty());
+    check_true(throwsOnCreate([]{SoapySDR::Converter(SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CS12);}));
+    check_true(throwsOnCreate([]{SoapySDR::Converter(SOAPY_SDR_CS12, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC);}));
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Batch conversion
+ **********************************************************************/
+static int testConvertBatch(void)
+{
+    printf("Check batch conversion:\n");
+    static const size_t numChans = 3;
+    std::vector<std::complex<float>> in[numChans], out[numChans];
+    std::vector<int16_t> cs16[numChans];
+    const void *srcBuffs[numChans];
+    void *dstBuffs[numChans];
+    for (size_t ch = 0; ch < numChans; ch++)
+    {
+        in[ch] = randomCF32(NUM_ELEMS);
+        out[ch].resize(NUM_ELEMS);
+        cs16[ch].resize(NUM_ELEMS*2);
+        srcBuffs[ch] = in[ch].data();
+        dstBuffs[ch] = cs16[ch].data();
+    }
+
+    //each channel matches its own conversion
+    SoapySDR::Converter toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16), toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32);
+    const double scalers[numChans] = {1.0, 0.5, 0.25};
+    toCS16.convertBatch(srcBuffs, dstBuffs, numChans, NUM_ELEMS, scalers);
+    for (size_t ch = 0; ch < numChans; ch++)
+    {
+        std::vector<int16_t> single(NUM_ELEMS*2);
+        toCS16.convert(in[ch].data(), single.data(), NUM_ELEMS, scalers[ch]);
+        check_true(single == cs16[ch]);
+    }
+    toCS16.convertBatch(srcBuffs, dstBuffs, numChans, NUM_ELEMS);
+    for (size_t ch = 0; ch < numChans; ch++)
+    {
+        toCF32.convert(cs16[ch].data(), out[ch].data(), NUM_ELEMS);
+        check_true(maxError(out[ch], in[ch]) < 1e-4f);
+    }
+
+    //complex scalers per channel
+    std::vector<std::complex<float>> expected(NUM_ELEMS);
+    const std::complex<double> rotations[numChans] = {{1.0, 0.0}, {0.0, 1.0}, {0.6, -0.8}};
+    toCS16.convertBatch(srcBuffs, dstBuffs, numChans, NUM_ELEMS, rotations);
+    for (size_t ch = 0; ch < numChans; ch++)
+    {
+        toCF32.convert(cs16[ch].data(), out[ch].data(), NUM_ELEMS);
+        for (size_t i = 0; i < NUM_ELEMS; i++) expected[i] = in[ch][i]*std::complex<float>(rotations[ch]);
+        check_true(maxError(out[ch], expected) < 1e-4f);
+    }
+
+    //the channels of a stateful converter would share one context
+    SoapySDR::Converter dither(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED);
+    check_true(dither.isStateful());
+    bool threw = false;
+    try
+    {
+        dither.convertBatch(srcBuffs, dstBuffs, numChans, NUM_ELEMS);
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    check_true(threw);
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Stateful converter lifecycle
+ **********************************************************************/
+static int testStatefulLifecycle(void)
+{
+    printf("Check stateful lifecycle:\n");
+    const auto in = randomCF32(NUM_ELEMS);
+    SoapySDR::Kwargs args;
+    args["seed"] = "1234";
+    auto ditherOnce = [&in](const SoapySDR::Converter &converter)
+    {
+        std::vector<int16_t> out(NUM_ELEMS*2);
+        converter.convert(in.data(), out.data(), NUM_ELEMS);
+        return out;
+    };
+
+    //the context carries over between calls, and reset returns to the initial state
+    SoapySDR::Converter dither(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED, args);
+    check_true(dither.isStateful());
+    check_true(dither.getFunction() == nullptr);
+    const auto first = ditherOnce(dither);
+    const auto second = ditherOnce(dither);
+    check_true(first != second);
+    dither.reset();
+    check_true(ditherOnce(dither) == first);
+
+    //a copy creates a fresh context, a move keeps the context
+    SoapySDR::Converter copy(dither);
+    check_true(copy.isStateful());
+    check_true(ditherOnce(copy) == first);
+    SoapySDR::Converter moved(std::move(dither));
+    check_true(ditherOnce(moved) == second);
+    copy = moved;
+    check_true(ditherOnce(copy) == first);
+    SoapySDR::Converter assigned;
+    check_true(not assigned.isValid());
+    assigned = std::move(moved);
+    check_true(assigned.isStateful());
+
+    //a buffer split into calls continues the stream, with calls on whole groups of lanes
+    SoapySDR::Converter split(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED, args);
+    std::vector<int16_t> out(NUM_ELEMS*2);
+    split.convert(in.data(), out.data(), 2048);
+    split.convert(in.data()+2048, out.data()+2048*2, NUM_ELEMS-2048);
+    check_true(out == first);
+
+    //the channels of a batch are separate streams
+    const void *srcBuffs[1] = {in.data()};
+    void *dstBuffs[1] = {out.data()};
+    const std::complex<double> rotation(0.0, 1.0);
+    bool threw = false;
+    try
+    {
+        split.convertBatch(srcBuffs, dstBuffs, 1, NUM_ELEMS, &rotation);
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    check_true(threw);
+
+    //a parallel conversion is the same stream, converted in order on the calling thread
+    SoapySDR::Converter serial(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED, args);
+    SoapySDR::Converter parallel(serial);
+    for (size_t i = 0; i < 2; i++)
+    {
+        const auto expected = ditherOnce(serial);
+        parallel.convertParallel(in.data(), out.data(), NUM_ELEMS, 1.0, 4);
+        check_true(out == expected);
+    }
+
+    //the default converter is stateless
+    check_true(not SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16).isStateful());
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Dither statistics
+ **********************************************************************/
+//dither a buffer and return the output parts in units of the target LSB
+static std::vector<double> ditherParts(const SoapySDR::Converter &converter, const std::vector<float> &in)
+{
+    const size_t numElems = in.size()/2;
+    const std::string &target = converter.getTargetFormat();
+    std::vector<uint8_t> out(numElems*converter.getTargetElementSize());
+    converter.convert(in.data(), out.data(), numElems);
+
+    std::vector<double> parts(in.size());
+    if (target == SOAPY_SDR_CS16 or target == SOAPY_SDR_CS12)
+    {
+        //CS12 is decoded through CS16, the 12 bits in the high bits
+        std::vector<int16_t> cs16(in.size());
+        if (target == SOAPY_SDR_CS12) SoapySDR::Converter(SOAPY_SDR_CS12, SOAPY_SDR_CS16).convert(out.data(), cs16.data(), numElems);
+        else std::copy((const int16_t *)out.data(), (const int16_t *)out.data() + in.size(), cs16.begin());
+        for (size_t i = 0; i < parts.size(); i++) parts[i] = (target == SOAPY_SDR_CS12)?cs16[i]/16.0:cs16[i];
+    }
+    else if (target == SOAPY_SDR_CU8) for (size_t i = 0; i < parts.size(); i++) parts[i] = int(out[i]) - 128;
+    else for (size_t i = 0; i < parts.size(); i++) parts[i] = int8_t(out[i]);
+    return parts;
+}
+
+static int testDitherStatistics(void)
+{
+    printf("Check dither statistics:\n");
+    static const size_t numParts = 1 << 17;
+    const std::pair<const char *, double> targets[] = {
+        {SOAPY_SDR_CS16, 32768.0}, {SOAPY_SDR_CS12, 2048.0}, {SOAPY_SDR_CS8, 128.0}, {SOAPY_SDR_CU8, 128.0}};
+    SoapySDR::Kwargs args;
+    args["seed"] = "42";
+
+    for (const auto &target : targets)
+    {
+        printf("  CF32 to %s:\n", target.first);
+        SoapySDR::Converter dither(SOAPY_SDR_CF32, target.first, SoapySDR::ConverterRegistry::DITHERED, args);
+
+        //a constant between two levels: the mean keeps the fraction, which plain rounding loses
+        const std::vector<float> constant(numParts, float(0.3/target.second));
+        double mean = 0.0;
+        for (const auto part : ditherParts(dither, constant)) mean += part/numParts;
+        check_true(std::abs(mean - 0.3) < 0.01);
+        SoapySDR::Converter plain(SOAPY_SDR_CF32, target.first);
+        mean = 0.0;
+        for (const auto part : ditherParts(plain, constant)) mean += part/numParts;
+        check_true(std::abs(mean) < 1e-9);
+
+        //over a random input, the error has no bias and the variance of rounding plus TPDF: 1/12 + 1/6
+        std::vector<float> in(numParts);
+        for (auto &x : in) x = float((std::rand()/double(RAND_MAX) - 0.5)*100/target.second);
+        const auto parts = ditherParts(dither, in);
+        double errorMean = 0.0, errorPower = 0.0;
+        for (size_t i = 0; i < numParts; i++)
+        {
+            const double error = parts[i] - double(in[i])*target.second;
+            errorMean += error/numParts;
+            errorPower += error*error/numParts;
+        }
+        check_true(std::abs(errorMean) < 0.01);
+        check_true(std::abs(errorPower - errorMean*errorMean - 0.25) < 0.01);
+
+        //the dither does not overflow at full scale
+        const std::vector<float> fullScale(numParts, 1.0f), negativeFullScale(numParts, -1.0f);
+        const auto high = ditherParts(dither, fullScale), low = ditherParts(dither, negativeFullScale);
+        check_true(*std::min_element(high.begin(), high.end()) >= target.second-2);
+        check_true(*std::max_element(low.begin(), low.end()) <= -target.second+1);
+
+        //inputs beyond full scale saturate, with and without noise shaping,
+        //and the shaped loop converts the next in range samples as before
+        static const float beyond[] = {1.5f, 4.0f, 1e6f, 1e30f};
+        std::vector<float> outOfRange;
+        for (size_t i = 0; i < 64; i++) outOfRange.push_back(((i/2)%2 == 0?1:-1)*beyond[(i/4)%4]);
+        SoapySDR::Kwargs shapingArgs(args);
+        shapingArgs["noiseShaping"] = "true";
+        for (const auto &ditherArgs : {args, shapingArgs})
+        {
+            SoapySDR::Converter converter(SOAPY_SDR_CF32, target.first, SoapySDR::ConverterRegistry::DITHERED, ditherArgs);
+            const auto saturated = ditherParts(converter, outOfRange);
+            size_t numBad = 0;
+            for (size_t i = 0; i < saturated.size(); i++)
+            {
+                if (saturated[i] != ((outOfRange[i] > 0)?target.second-1:-target.second)) numBad++;
+            }
+            const std::vector<float> small(64, float(0.3/target.second));
+            for (const auto part : ditherParts(converter, small)) if (std::abs(part - 0.3) > 2.0) numBad++;
+            check_true(numBad == 0);
+        }
+    }
+
+    //the same seed repeats the dither, other seeds and the default seeds do not
+    std::vector<float> in(numParts);
+    for (auto &x : in) x = float(std::rand()/double(RAND_MAX) - 0.5);
+    const auto first = ditherParts(SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED, args), in);
+    check_true(ditherParts(SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED, args), in) == first);
+    SoapySDR::Kwargs otherArgs;
+    otherArgs["seed"] = "43";
+    check_true(ditherParts(SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED, otherArgs), in) != first);
+    check_true(ditherParts(SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED), in) !=
+               ditherParts(SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED), in));
+
+    //first-order noise shaping: the error is the difference of the fed back errors,
+    //so its running sum per part (no error at DC) stays within the quantizer range
+    args["noiseShaping"] = "true";
+    SoapySDR::Converter shaped(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED, args);
+    for (auto &x : in) x = float((std::rand()/double(RAND_MAX) - 0.5)*100/32768);
+    double sum[2] = {0.0, 0.0}, maxSum = 0.0;
+    double unshapedSum[2] = {0.0, 0.0}, maxUnshapedSum = 0.0;
+    const auto shapedParts = ditherParts(shaped, in);
+    const auto unshapedParts = ditherParts(SoapySDR::Converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::DITHERED), in);
+    for (size_t i = 0; i < numParts; i++)
+    {
+        sum[i & 1] += shapedParts[i] - double(in[i])*32768;
+        unshapedSum[i & 1] += unshapedParts[i] - double(in[i])*32768;
+        maxSum = std::max(maxSum, std::abs(sum[i & 1]));
+        maxUnshapedSum = std::max(maxUnshapedSum, std::abs(unshapedSum[i & 1]));
+    }
+    check_true(maxSum < 2.0);
+    check_true(maxUnshapedSum > 10.0);
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Parallel conversion
+ **********************************************************************/
+//a buffer in a format, passed as an array of plane pointers for planar formats
+struct FormatBuffer
+{
+    FormatBuffer(const std::string &format, const size_t numElems):
+        planar(format.find("_PLANAR") != std::string::npos),
+        data(numElems*SoapySDR::formatToSize(format))
+    {
+        planes[0] = data.data();
+        planes[1] = data.data() + data.size()/2;
+    }
+
+    void *get(void)
+    {
+        return planar?(void *)planes:planes[0];
+    }
+
+    bool planar;
+    std::vector<uint8_t> data;
+    void *planes[2];
+};
+
+static void fillFormatBuffer(FormatBuffer &buff, const std::string &format)
+{
+    if (format.compare(0, 4, SOAPY_SDR_CF32) == 0)
+    {
+        const auto values = randomCF32(buff.data.size()/8);
+        std::memcpy(buff.data.data(), values.data(), buff.data.size());
+    }
+    else for (auto &byte : buff.data) byte = uint8_t(std::rand());
+}
+
+static int testConvertParallel(void)
+{
+    printf("Check parallel conversion:\n");
+
+    //lengths around the chunk sizes, which depend on the element sizes
+    static const size_t lengths[] = {0, 1, 4095, 32767, 32768, 32769, 65537, 100003};
+    const std::pair<const char *, const char *> pairs[] = {
+        {SOAPY_SDR_CF32, SOAPY_SDR_CS16}, {SOAPY_SDR_CS16, SOAPY_SDR_CF32}, {SOAPY_SDR_CF32, SOAPY_SDR_CS12},
+        {SOAPY_SDR_CF32, SOAPY_SDR_CF32_PLANAR}, {SOAPY_SDR_CF32_PLANAR, SOAPY_SDR_CF32}, {SOAPY_SDR_CS12, SOAPY_SDR_CS8}};
+    for (const auto &pair : pairs)
+    {
+        printf("  %s to %s:\n", pair.first, pair.second);
+        SoapySDR::Converter converter(pair.first, pair.second);
+        size_t numBad = 0;
+        for (const size_t numElems : lengths)
+        {
+            FormatBuffer src(pair.first, numElems), expected(pair.second, numElems), out(pair.second, numElems);
+            fillFormatBuffer(src, pair.first);
+            converter.convert(src.get(), expected.get(), numElems, 0.5);
+            for (const size_t numThreads : {0, 1, 2, 3})
+            {
+                std::fill(out.data.begin(), out.data.end(), 0);
+                converter.convertParallel(src.get(), out.get(), numElems, 0.5, numThreads);
+                if (out.data != expected.data) numBad++;
+            }
+        }
+        check_true(numBad == 0);
+    }
+
+    //concurrent callers share the pool, each with its own buffers
+    static const size_t numCallers = 4, numElems = 100003;
+    SoapySDR::Converter converter(SOAPY_SDR_CF32, SOAPY_SDR_CS16);
+    const auto in = randomCF32(numElems);
+    std::vector<int16_t> expected(numElems*2);
+    converter.convert(in.data(), expected.data(), numElems);
+    std::atomic<size_t> numBad(0);
+    std::vector<std::thread> callers;
+    for (size_t i = 0; i < numCallers; i++)
+    {
+        callers.emplace_back([&]
+        {
+            std::vector<int16_t> out(numElems*2);
+            for (size_t n = 0; n < 20; n++)
+            {
+                std::fill(out.begin(), out.end(), 0);
+                converter.convertParallel(in.data(), out.data(), numElems);
+                if (out != expected) numBad++;
+            }
+        });
+    }
+    for (auto &caller : callers) caller.join();
+    check_true(numBad == 0);
+
+    //a chunk that throws on the caller or on a worker throws to the caller, and the pool stays usable
+    static const SoapySDR::ConverterRegistry throwing(SOAPY_SDR_F32, "THROW32", SoapySDR::ConverterRegistry::GENERIC,
+        [](const void *srcBuff, void *, const size_t numElems, const double)
+        {
+            const float *src = (const float *)srcBuff;
+            if (std::find(src, src+numElems, -1.0f) != src+numElems) throw std::runtime_error("THROW32");
+        });
+    SoapySDR::Converter thrower(SOAPY_SDR_F32, "THROW32");
+    std::vector<float> src(numElems), dst(numElems);
+    size_t numThrown = 0;
+    for (size_t n = 0; n < 20; n++)
+    {
+        //every chunk throws, then only the last chunk throws
+        std::fill(src.begin(), src.end(), (n%2 == 0)?-1.0f:0.0f);
+        src.back() = -1.0f;
+        try
+        {
+            thrower.convertParallel(src.data(), dst.data(), numElems);
+        }
+        catch (const std::runtime_error &)
+        {
+            numThrown++;
+        }
+    }
+    check_true(numThrown == 20);
+    std::fill(src.begin(), src.end(), 0.0f);
+    thrower.convertParallel(src.data(), dst.data(), numElems);
+    std::vector<int16_t> out(numElems*2);
+    converter.convertParallel(in.data(), out.data(), numElems);
+    check_true(out == expected);
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * 32-bit integer widths
+ **********************************************************************/
+static int testIntegerWidths(void)
+{
+    printf("Check 32-bit integer widths:\n");
+
+    //every narrow value widens to the high bits and narrows back to itself
+    const std::pair<const char *, const char *> pairs[] = {
+        {SOAPY_SDR_S32, SOAPY_SDR_S8}, {SOAPY_SDR_S32, SOAPY_SDR_U8}, {SOAPY_SDR_S32, SOAPY_SDR_U16},
+        {SOAPY_SDR_CS32, SOAPY_SDR_CS8}, {SOAPY_SDR_CS32, SOAPY_SDR_CU8}, {SOAPY_SDR_CS32, SOAPY_SDR_CU16}};
+    for (const auto &pair : pairs)
+    {
+        printf("  %s and %s:\n", pair.first, pair.second);
+        SoapySDR::Converter narrow(pair.first, pair.second), widen(pair.second, pair.first);
+        check_true(narrow.getPath().size() == 2);
+        check_true(widen.getPath().size() == 2);
+
+        const size_t partSize = SoapySDR::formatToSize(pair.second)/narrow.getTargetElementDepth();
+        const size_t numElems = (size_t(1) << (partSize*8))/narrow.getTargetElementDepth();
+        std::vector<uint8_t> in(numElems*narrow.getTargetElementSize()), back(in.size());
+        for (size_t i = 0; i < in.size()/partSize; i++) std::memcpy(in.data() + i*partSize, &i, partSize);
+        std::vector<int32_t> wide(numElems*narrow.getSourceElementDepth());
+        widen.convert(in.data(), wide.data(), numElems);
+        narrow.convert(wide.data(), back.data(), numElems);
+        check_true(back == in);
+
+        //the zero of an offset binary format widens to zero, the signed extremes stay extremes
+        const auto minmax = std::minmax_element(wide.begin(), wide.end());
+        check_true(*minmax.first == INT32_MIN);
+        check_true(*minmax.second == int32_t(uint32_t(INT32_MAX) >> (32-partSize*8) << (32-partSize*8)));
+        check_true(std::count(wide.begin(), wide.end(), 0) == std::count(wide.begin(), wide.end(), INT32_MIN));
+    }
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Big endian floats
+ **********************************************************************/
+static int testBigEndianFloats(void)
+{
+    printf("Check big endian floats:\n");
+
+    //finite values whose byte swapped patterns cover every exponent, including NaNs
+    std::vector<uint32_t> bits;
+    for (uint32_t i = 0; i < 65536; i++)
+    {
+        const uint32_t pattern = i*2654435761u;
+        if ((pattern & 0x7f800000) != 0x7f800000) bits.push_back(pattern);
+    }
+    std::vector<uint8_t> swapped(bits.size()*4);
+    for (size_t i = 0; i < bits.size(); i++)
+    {
+        for (size_t b = 0; b < 4; b++) swapped[i*4+b] = uint8_t(bits[i] >> (24-b*8));
+    }
+
+    for (const auto &formats : {std::make_pair(SOAPY_SDR_F32, SOAPY_SDR_F32_BE), std::make_pair(SOAPY_SDR_CF32, SOAPY_SDR_CF32_BE)})
+    {
+        printf("  %s and %s:\n", formats.first, formats.second);
+        const size_t numElems = bits.size()/SoapySDR::formatToSize(formats.first)*4;
+        for (const auto priority : SoapySDR::ConverterRegistry::listPriorities(formats.first, formats.second))
+        {
+            std::vector<uint8_t> out(swapped.size());
+            std::vector<uint32_t> back(bits.size());
+            SoapySDR::ConverterRegistry::getFunction(formats.first, formats.second, priority)(bits.data(), out.data(), numElems, 1.0);
+            SoapySDR::ConverterRegistry::getFunction(formats.second, formats.first, priority)(out.data(), back.data(), numElems, 1.0);
+            check_true(out == swapped);
+            check_true(back == bits);
+        }
+    }
+
+    //big endian integers are stored high byte first on any host
+    const int16_t s16[] = {0x1234, -2};
+    uint8_t s16be[4];
+    SoapySDR::Converter(SOAPY_SDR_CS16, SOAPY_SDR_CS16_BE).convert(s16, s16be, 1);
+    check_true(s16be[0] == 0x12 and s16be[1] == 0x34 and s16be[2] == 0xff and s16be[3] == 0xfe);
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * C API
+ **********************************************************************/
+static int testCAPI(void)
+{
+    printf("Check C API:\n");
+    SoapySDRConverter *converter = SoapySDRConverter_make(SOAPY_SDR_F32, SOAPY_SDR_S16);
+    check_true(converter != nullptr);
+    check_true(SoapySDRConverter_getSourceElementDepth(converter) == 1);
+    check_true(SoapySDRConverter_getTargetElementDepth(converter) == 1);
+    SoapySDRConverter_unmake(converter);
+    converter = SoapySDRConverter_make(SOAPY_SDR_CF32, SOAPY_SDR_CS16);
+    check_true(SoapySDRConverter_getSourceElementDepth(converter) == 2);
+    check_true(SoapySDRConverter_getTargetElementDepth(converter) == 2);
+
+    //errors are returned as codes, with the message in the last error
+    const auto in = randomCF32(NUM_ELEMS);
+    std::vector<int16_t> cs16(NUM_ELEMS*2);
+    std::vector<int8_t> cs8(NUM_ELEMS*2);
+    check_true(SoapySDRConverter_convert(converter, in.data(), cs16.data(), NUM_ELEMS, 1.0) == 0);
+    check_true(SoapySDRConverter_reset(converter) == 0);
+    SoapySDRConverter_unmake(converter);
+    converter = SoapySDRConverter_make(SOAPY_SDR_CS16, SOAPY_SDR_CS8);
+    check_true(SoapySDRConverter_convertComplex(converter, cs16.data(), cs8.data(), NUM_ELEMS, 1.0, 0.0) != 0);
+    check_true(std::strlen(SoapySDRDevice_lastError()) != 0);
+    SoapySDRConverter_unmake(converter);
+    return EXIT_SUCCESS;
+}
+
+int main(void)
+{
+    if (testComplexScaler() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testPathChaining() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testIntegerWidths() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testBigEndianFloats() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testConvertBatch() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testConvertParallel() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testStatefulLifecycle() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testDitherStatistics() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testCAPI() != EXIT_SUCCESS) return EXIT_FAILURE;
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
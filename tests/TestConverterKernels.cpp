@@ -0,0 +1,474 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+// Differential test of the registered converter functions.
+//
+// For each source and target pair with more than one function
+// (several priorities, or several instruction sets usable on this CPU),
+// every function is compared with the reference: the lowest priority
+// function for the generic instruction set. Each function converts
+// random and edge case inputs (full scale, zero, rounding ties, integer limits)
+// at every length up to 67 elements and at longer lengths around vector sizes,
+// from aligned and misaligned buffers, with several scale factors.
+//
+// Outputs are decoded to F32 or CF32 with the reference decoder,
+// and compared within one step of an integer target format,
+// or the precision of a float target format.
+// Guard bytes around each output catch writes past either end.
+// The lookup table converters are also checked with more scale factors
+// than they keep tables for, so the arithmetic fallback is covered.
+//
+// Float inputs go beyond full scale, up to values far out of range:
+// every converter to an integer format saturates to the limits of the format,
+// including +1.0, which is one step beyond the largest integer value.
+// The decoded floats can not tell the 32-bit limits from their neighbors,
+// so the conversions from float to 32-bit integers are also compared exactly.
+
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+typedef SoapySDR::ConverterRegistry Registry;
+
+static const size_t MAX_ELEMS = 4099;
+static const size_t MAX_OFFSET = 3; //in elements
+static const size_t ALIGNMENT = 64;
+static const size_t GUARD_SIZE = 64;
+static const uint8_t GUARD_BYTE = 0xa5;
+static const size_t MAX_REPORTS = 5;
+
+static const char *isaName(const Registry::InstructionSet isa)
+{
+    switch (isa)
+    {
+    case Registry::ISA_GENERIC: return "generic";
+    case Registry::ISA_SSE2: return "sse2";
+    case Registry::ISA_SSE41: return "sse4.1";
+    case Registry::ISA_AVX2: return "avx2";
+    case Registry::ISA_AVX512: return "avx512";
+    }
+    return "unknown";
+}
+
+/***********************************************************************
+ * Format helpers
+ **********************************************************************/
+static bool isPlanar(const std::string &format)
+{
+    return format.find("_PLANAR") != std::string::npos;
+}
+
+static bool isComplex(const std::string &format)
+{
+    return format[0] == 'C';
+}
+
+static bool isFloat(const std::string &format)
+{
+    return format[isComplex(format)?1:0] == 'F';
+}
+
+static bool isBigEndian(const std::string &format)
+{
+    return format.find("_BE") != std::string::npos;
+}
+
+//the number of bits in one part (the I or Q of a complex format)
+static size_t partBits(const std::string &format)
+{
+    return std::strtoul(format.c_str() + (isComplex(format)?2:1), nullptr, 10);
+}
+
+/***********************************************************************
+ * A buffer in a format, one or two planes,
+ * aligned at the start and surrounded by guard bytes
+ **********************************************************************/
+struct TestBuffer
+{
+    TestBuffer(const std::string &format):
+        planar(isPlanar(format)),
+        planeElemSize(SoapySDR::formatToSize(format)/(planar?2:1)),
+        planeSize((MAX_ELEMS+MAX_OFFSET)*planeElemSize)
+    {
+        for (size_t p = 0; p < 2; p++)
+        {
+            mem[p].resize(planeSize + 2*GUARD_SIZE + ALIGNMENT);
+            const size_t misalign = size_t(mem[p].data() + GUARD_SIZE) % ALIGNMENT;
+            planes[p] = mem[p].data() + GUARD_SIZE + (misalign?ALIGNMENT-misalign:0);
+        }
+    }
+
+    size_t numPlanes(void) const
+    {
+        return planar?2:1;
+    }
+
+    //the buffer argument of a converter function, starting at an element offset
+    void *get(const size_t offset)
+    {
+        offsetPlanes[0] = planes[0] + offset*planeElemSize;
+        offsetPlanes[1] = planes[1] + offset*planeElemSize;
+        return planar?(void *)offsetPlanes:offsetPlanes[0];
+    }
+
+    void fillGuard(void)
+    {
+        for (size_t p = 0; p < numPlanes(); p++) std::memset(mem[p].data(), GUARD_BYTE, mem[p].size());
+    }
+
+    //were bytes written outside of the elements at an offset?
+    bool checkGuard(const size_t offset, const size_t numElems) const
+    {
+        for (size_t p = 0; p < numPlanes(); p++)
+        {
+            const uint8_t *begin = planes[p] + offset*planeElemSize;
+            const uint8_t *end = begin + numElems*planeElemSize;
+            for (const uint8_t *b = mem[p].data(); b < begin; b++) if (*b != GUARD_BYTE) return false;
+            for (const uint8_t *b = end; b < mem[p].data() + mem[p].size(); b++) if (*b != GUARD_BYTE) return false;
+        }
+        return true;
+    }
+
+    bool planar;
+    size_t planeElemSize;
+    size_t planeSize;
+    std::vector<uint8_t> mem[2];
+    uint8_t *planes[2];
+    uint8_t *offsetPlanes[2];
+};
+
+/***********************************************************************
+ * Inputs
+ **********************************************************************/
+//a fifth of the values are beyond full scale
+static double randomFloat(void)
+{
+    return ((std::rand()/(RAND_MAX+1.0))*2 - 1)*1.25;
+}
+
+//full scale, out of range values, and zero, and values halfway between two steps of the integer formats
+static double edgeFloat(const size_t i)
+{
+    static const double limits[] = {0.0, -0.0, 1.0, -1.0, 0.99999994, -0.99999994, 0.5, -0.5, 1e-6, -1e-6,
+        1.00001, -1.00001, 1.5, -1.5, 4.0, -4.0, 1e6, -1e6, 1e30, -1e30};
+    static const double fullScales[] = {8.0, 128.0, 2048.0, 32768.0};
+    if (i % 2 == 0) return limits[(i/2) % (sizeof(limits)/sizeof(limits[0]))];
+    const double fullScale = fullScales[(i/2) % 4];
+    const double tie = ((std::rand() % int(fullScale)) + 0.5)/fullScale;
+    return (std::rand() % 2)?tie:-tie;
+}
+
+//integer limits and their neighbors, little endian
+static uint64_t edgeInteger(const size_t i, const size_t bits)
+{
+    const uint64_t max = (uint64_t(1) << (bits-1)) - 1;
+    const uint64_t values[] = {0, 1, ~uint64_t(0), max, max-1, max+1, max+2, uint64_t(std::rand())};
+    return values[i % (sizeof(values)/sizeof(values[0]))];
+}
+
+static void byteSwap(uint8_t *part, const size_t size)
+{
+    std::reverse(part, part + size);
+}
+
+static void fillInput(TestBuffer &buff, const std::string &format, const bool edges)
+{
+    const size_t bits = partBits(format);
+    const bool packed = (bits % 8) != 0;
+    const size_t partSize = packed?1:bits/8;
+    for (size_t p = 0; p < buff.numPlanes(); p++)
+    {
+        uint8_t *out = buff.planes[p];
+        for (size_t i = 0; i < buff.planeSize/partSize; i++)
+        {
+            uint8_t *part = out + i*partSize;
+            if (isFloat(format))
+            {
+                const double value = edges?edgeFloat(i):randomFloat();
+                if (partSize == 2)
+                {
+                    const uint16_t half = SoapySDR::F32toF16(float(value));
+                    std::memcpy(part, &half, 2);
+                }
+                else if (partSize == 4)
+                {
+                    const float f = float(value);
+                    std::memcpy(part, &f, 4);
+                }
+                else std::memcpy(part, &value, 8);
+            }
+            else if (edges and not packed)
+            {
+                const uint64_t value = edgeInteger(i, bits);
+                std::memcpy(part, &value, partSize);
+            }
+            else if (edges) *part = uint8_t(edgeInteger(i, 8));
+            else for (size_t b = 0; b < partSize; b++) part[b] = uint8_t(std::rand());
+            if (isBigEndian(format) and SOAPY_SDR_LITTLE_ENDIAN) byteSwap(part, partSize);
+        }
+    }
+}
+
+/***********************************************************************
+ * Comparison
+ **********************************************************************/
+static double tolerance(const std::string &format, const float a, const float b)
+{
+    const double magnitude = std::max(std::abs(a), std::abs(b));
+    const size_t bits = partBits(format);
+    if (isFloat(format) and bits == 16) return magnitude/1024 + 1.0/(1 << 24);
+    if (isFloat(format)) return magnitude/(1 << 21) + 1e-30;
+
+    //one step of the integer format, and the precision of the decoded floats
+    return 1.001/(uint64_t(1) << (bits-1)) + magnitude/(1 << 22);
+}
+
+static bool equivalent(const std::string &format, const float a, const float b)
+{
+    if (std::isnan(a) or std::isnan(b)) return std::isnan(a) and std::isnan(b);
+    if (std::isinf(a) or std::isinf(b)) return a == b;
+    return std::abs(a - b) <= tolerance(format, a, b);
+}
+
+/***********************************************************************
+ * The reference primitives
+ **********************************************************************/
+//the float to integer primitives saturate at the limits of each format, and NaN converts to 0
+static size_t testPrimitives(void)
+{
+    const double nan = std::nan("");
+    const bool ok =
+        SoapySDR::F32toS32(1.0f) == INT32_MAX and SoapySDR::F32toS32(-1.5f) == INT32_MIN and SoapySDR::F32toS32(float(nan)) == 0 and
+        SoapySDR::F32toS16(1.0f) == INT16_MAX and SoapySDR::F32toS16(-1.5f) == INT16_MIN and SoapySDR::F32toS16(float(nan)) == 0 and
+        SoapySDR::F32toS8(1.0f) == INT8_MAX and SoapySDR::F32toS8(-1.5f) == INT8_MIN and SoapySDR::F32toS8(float(nan)) == 0 and
+        SoapySDR::F64toS32(1.0) == INT32_MAX and SoapySDR::F64toS32(-1.5) == INT32_MIN and SoapySDR::F64toS32(nan) == 0 and
+        SoapySDR::F64toS16(1.0) == INT16_MAX and SoapySDR::F64toS16(-1.5) == INT16_MIN and SoapySDR::F64toS16(nan) == 0 and
+        SoapySDR::F64toS8(1.0) == INT8_MAX and SoapySDR::F64toS8(-1.5) == INT8_MIN and SoapySDR::F64toS8(nan) == 0;
+    printf("Reference primitives: %s\n", ok?"PASS":"FAIL");
+    return ok?0:1;
+}
+
+//the lowest priority function for the lowest instruction set
+static Registry::ConverterFunction getReference(const std::string &source, const std::string &target, Registry::FunctionPriority *priority = nullptr)
+{
+    const auto priorities = Registry::listPriorities(source, target);
+    if (priorities.empty()) return nullptr;
+    const auto isas = Registry::listInstructionSets(source, target, priorities.front());
+    if (isas.empty()) return nullptr;
+    if (priority != nullptr) *priority = priorities.front();
+    return Registry::getFunction(source, target, priorities.front(), isas.front());
+}
+
+struct Candidate
+{
+    Registry::FunctionPriority priority;
+    Registry::InstructionSet isa;
+    Registry::ConverterFunction function;
+};
+
+//test all functions for a pair, return the number of failures
+static size_t testPair(const std::string &source, const std::string &target)
+{
+    Registry::FunctionPriority refPriority;
+    const auto reference = getReference(source, target, &refPriority);
+    const std::string decodedFormat = isComplex(target)?SOAPY_SDR_CF32:SOAPY_SDR_F32;
+    const auto decoder = getReference(target, decodedFormat);
+    if (reference == nullptr or decoder == nullptr)
+    {
+        printf("  %s -> %s: SKIP (no reference)\n", source.c_str(), target.c_str());
+        return 0;
+    }
+
+    std::vector<Candidate> candidates;
+    for (const auto priority : Registry::listPriorities(source, target))
+    {
+        for (const auto isa : Registry::listInstructionSets(source, target, priority))
+        {
+            const auto function = Registry::getFunction(source, target, priority, isa);
+            if (function != reference) candidates.push_back(Candidate{priority, isa, function});
+        }
+    }
+    if (candidates.empty()) return 0;
+
+    std::vector<size_t> lengths;
+    for (size_t n = 0; n <= 67; n++) lengths.push_back(n);
+    for (const size_t n : {127, 128, 129, 255, 256, 257, 1000, 2047, 2048, 2049, 4099}) lengths.push_back(n);
+
+    const size_t depth = isComplex(target)?2:1;
+    TestBuffer src(source), refOut(target), testOut(target);
+    std::vector<float> refDecoded(MAX_ELEMS*depth), testDecoded(MAX_ELEMS*depth);
+    std::vector<size_t> failures(candidates.size(), 0);
+
+    for (const bool edges : {false, true})
+    {
+        for (const double scaler : {1.0, 0.5, 0.3})
+        {
+            fillInput(src, source, edges);
+            for (const size_t offset : {size_t(0), size_t(1), MAX_OFFSET})
+            {
+                for (const size_t numElems : lengths)
+                {
+                    refOut.fillGuard();
+                    reference(src.get(offset), refOut.get(offset), numElems, scaler);
+                    decoder(refOut.get(offset), refDecoded.data(), numElems, 1.0);
+
+                    for (size_t c = 0; c < candidates.size(); c++)
+                    {
+                        testOut.fillGuard();
+                        candidates[c].function(src.get(offset), testOut.get(offset), numElems, scaler);
+                        decoder(testOut.get(offset), testDecoded.data(), numElems, 1.0);
+
+                        const char *error = nullptr;
+                        size_t index = numElems*depth;
+                        if (not testOut.checkGuard(offset, numElems)) error = "wrote outside of the output";
+                        else for (size_t i = 0; i < numElems*depth; i++)
+                        {
+                            if (equivalent(target, refDecoded[i], testDecoded[i])) continue;
+                            error = "output mismatch";
+                            index = i;
+                            break;
+                        }
+
+                        if (error == nullptr) continue;
+                        if (failures[c]++ < MAX_REPORTS)
+                        {
+                            printf("  %s -> %s: priority %d %s: %s (%s inputs, scaler=%g, offset=%zu, numElems=%zu",
+                                source.c_str(), target.c_str(), int(candidates[c].priority), isaName(candidates[c].isa),
+                                error, edges?"edge":"random", scaler, offset, numElems);
+                            if (index < numElems*depth) printf(", index=%zu, reference=%g, result=%g", index, refDecoded[index], testDecoded[index]);
+                            printf(")\n");
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    size_t numFailures = 0;
+    for (size_t c = 0; c < candidates.size(); c++)
+    {
+        printf("  %s -> %s: priority %d %s vs priority %d generic ... %s\n",
+            source.c_str(), target.c_str(), int(candidates[c].priority), isaName(candidates[c].isa),
+            int(refPriority), (failures[c] == 0)?"PASS":"FAIL");
+        numFailures += failures[c];
+    }
+    return numFailures;
+}
+
+/***********************************************************************
+ * Lookup tables
+ **********************************************************************/
+//the 8-bit complex formats keep a table per scaler, up to a limit,
+//and convert with arithmetic beyond it; both must match the reference
+static size_t testLookupTables(const std::string &source)
+{
+    const auto reference = getReference(source, SOAPY_SDR_CF32);
+    const auto table = Registry::getFunction(source, SOAPY_SDR_CF32, Registry::VECTORIZED, Registry::ISA_GENERIC);
+    if (reference == nullptr or table == nullptr or table == reference) return 0;
+
+    //every I and Q pair
+    std::vector<uint8_t> in(65536*2);
+    for (size_t i = 0; i < 65536; i++)
+    {
+        in[i*2+0] = uint8_t(i & 0xff);
+        in[i*2+1] = uint8_t(i >> 8);
+    }
+
+    //more scalers than tables, used in turn and then in reverse
+    std::vector<double> scalers;
+    for (size_t i = 0; i < 20; i++) scalers.push_back(1.0/(i+1));
+    for (size_t i = 0; i < 20; i++) scalers.push_back(1.0/(20-i));
+
+    std::vector<float> refOut(65536*2), testOut(65536*2);
+    size_t numFailures = 0;
+    for (const double scaler : scalers)
+    {
+        reference(in.data(), refOut.data(), 65536, scaler);
+        table(in.data(), testOut.data(), 65536, scaler);
+        if (std::memcmp(refOut.data(), testOut.data(), refOut.size()*sizeof(float)) == 0) continue;
+        if (numFailures++ < MAX_REPORTS) printf("  %s -> CF32: lookup table: output mismatch (scaler=%g)\n", source.c_str(), scaler);
+    }
+    printf("  %s -> CF32: lookup table over %zu scalers ... %s\n", source.c_str(), scalers.size(), (numFailures == 0)?"PASS":"FAIL");
+    return numFailures;
+}
+
+/***********************************************************************
+ * Saturation to 32-bit integers
+ **********************************************************************/
+//the decoded floats can not tell INT32_MAX from the largest float below 2^31,
+//so the outputs beyond full scale are compared exactly, return the number of failures
+static size_t testSaturation(const std::string &source, const std::string &target)
+{
+    static const double values[] = {1.0, 1.5, 1e30, 0.99999994, -1.0, -1.5, -1e30};
+    static const size_t numParts = 37; //vectors and a tail
+    const auto reference = getReference(source, target);
+    if (reference == nullptr) return 0;
+
+    std::vector<uint8_t> in(numParts*partBits(source)/8);
+    for (size_t i = 0; i < numParts; i++)
+    {
+        const double value = values[i % (sizeof(values)/sizeof(values[0]))];
+        if (partBits(source) == 32)
+        {
+            const float f = float(value);
+            std::memcpy(in.data() + i*4, &f, 4);
+        }
+        else std::memcpy(in.data() + i*8, &value, 8);
+    }
+    const size_t numElems = numParts/(isComplex(source)?2:1);
+    std::vector<uint32_t> expected(numParts), out(numParts);
+    reference(in.data(), expected.data(), numElems, 1.0);
+
+    size_t numFailures = 0;
+    for (const auto priority : Registry::listPriorities(source, target))
+    {
+        for (const auto isa : Registry::listInstructionSets(source, target, priority))
+        {
+            std::fill(out.begin(), out.end(), 0);
+            Registry::getFunction(source, target, priority, isa)(in.data(), out.data(), numElems, 1.0);
+            if (std::equal(out.begin(), out.begin() + numElems*(isComplex(source)?2:1), expected.begin())) continue;
+            numFailures++;
+            printf("  %s -> %s: priority %d %s: saturation mismatch\n", source.c_str(), target.c_str(), int(priority), isaName(isa));
+        }
+    }
+    printf("  %s -> %s: saturation ... %s\n", source.c_str(), target.c_str(), (numFailures == 0)?"PASS":"FAIL");
+    return numFailures;
+}
+
+int main(void)
+{
+    std::srand(1);
+    printf("Instruction set: %s\n", isaName(Registry::getInstructionSet()));
+
+    size_t numFailures = testPrimitives();
+    for (const auto &source : Registry::listAvailableSourceFormats())
+    {
+        for (const auto &target : Registry::listTargetFormats(source))
+        {
+            if (SoapySDR::formatToSize(source) == 0 or SoapySDR::formatToSize(target) == 0) continue;
+            numFailures += testPair(source, target);
+            if (isFloat(source) and partBits(source) >= 32 and not isFloat(target) and partBits(target) == 32)
+            {
+                numFailures += testSaturation(source, target);
+            }
+        }
+    }
+    numFailures += testLookupTables(SOAPY_SDR_CS8);
+    numFailures += testLookupTables(SOAPY_SDR_CU8);
+
+    if (numFailures != 0)
+    {
+        printf("FAIL: %zu mismatched conversions\n", numFailures);
+        return EXIT_FAILURE;
+    }
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
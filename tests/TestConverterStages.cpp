@@ -0,0 +1,406 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterStages.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <algorithm>
+#include <complex>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#define check_true(x) \
+    printf("  Check %s ... ", #x); \
+    if (not (x)) \
+    { \
+        printf("FAIL\n"); \
+        return EXIT_FAILURE; \
+    } \
+    else printf("PASS\n")
+
+static const double TWO_PI = 6.283185307179586;
+
+//more than one chunk of the internal staging, and not a multiple of a vector
+static const size_t NUM_ELEMS = 5003;
+
+//call sizes that split a buffer across chunk and vector boundaries
+static const size_t CALL_SIZES[] = {1, 777, 2049, 3, 2048};
+
+static float maxError(const std::vector<std::complex<float>> &a, const std::vector<std::complex<float>> &b)
+{
+    float error = 0.0f;
+    for (size_t i = 0; i < std::min(a.size(), b.size()); i++) error = std::max(error, std::abs(a[i] - b[i]));
+    return error;
+}
+
+/***********************************************************************
+ * IQ correction converter
+ **********************************************************************/
+//the circularity of a signal: |E[y^2]|/E[|y|^2] is 0 without an image
+static double imageRatio(const std::vector<std::complex<float>> &y)
+{
+    std::complex<double> moment;
+    double power = 0.0;
+    for (const auto &v : y)
+    {
+        moment += std::complex<double>(v)*std::complex<double>(v);
+        power += std::norm(v);
+    }
+    return std::abs(moment)/power;
+}
+
+static std::complex<float> mean(const std::vector<std::complex<float>> &y)
+{
+    std::complex<double> sum;
+    for (const auto &v : y) sum += std::complex<double>(v);
+    return std::complex<float>(sum/double(y.size()));
+}
+
+static int testIQCorrectionConverter(void)
+{
+    printf("Check IQ correction converter:\n");
+
+    //a tone with a DC offset and an image
+    const std::complex<float> dc(0.1f, -0.05f), balance(0.08f, 0.03f);
+    std::vector<std::complex<float>> in(NUM_ELEMS), out(NUM_ELEMS), expected(NUM_ELEMS);
+    for (size_t i = 0; i < NUM_ELEMS; i++)
+    {
+        const auto s = std::complex<float>(std::polar(0.5, TWO_PI*0.0173*i));
+        in[i] = s + balance*std::conj(s) + dc;
+    }
+
+    //manual corrections: y = (x - dc) + balance*conj(x - dc)
+    SoapySDR::IQCorrectionConverter manual(SOAPY_SDR_CF32);
+    manual.setDCOffset(std::complex<double>(dc));
+    manual.setIQBalance(std::complex<double>(0.1, 0.2));
+    manual.convert(in.data(), out.data(), NUM_ELEMS);
+    for (size_t i = 0; i < NUM_ELEMS; i++) expected[i] = (in[i] - dc) + std::complex<float>(0.1f, 0.2f)*std::conj(in[i] - dc);
+    check_true(maxError(out, expected) < 1e-5f);
+
+    //the same from a planar source, each plane offset per chunk
+    std::vector<float> planeI(NUM_ELEMS), planeQ(NUM_ELEMS);
+    for (size_t i = 0; i < NUM_ELEMS; i++)
+    {
+        planeI[i] = in[i].real();
+        planeQ[i] = in[i].imag();
+    }
+    const void *planes[2] = {planeI.data(), planeQ.data()};
+    SoapySDR::IQCorrectionConverter planar(SOAPY_SDR_CF32_PLANAR);
+    planar.setDCOffset(std::complex<double>(dc));
+    planar.setIQBalance(std::complex<double>(0.1, 0.2));
+    planar.convert(planes, out.data(), NUM_ELEMS);
+    check_true(maxError(out, expected) < 1e-5f);
+
+    //automatic corrections converge on the offset and remove the image
+    SoapySDR::IQCorrectionConverter automatic(SOAPY_SDR_CF32);
+    automatic.setDCOffsetMode(true);
+    automatic.setIQBalanceMode(true);
+    automatic.setTrackingLength(4096);
+    automatic.convert(in.data(), out.data(), NUM_ELEMS);
+    const double initialImage = imageRatio(out);
+    for (size_t n = 0; n < 40; n++) automatic.convert(in.data(), out.data(), NUM_ELEMS);
+    check_true(std::abs(automatic.getDCOffset() - std::complex<double>(dc)) < 2e-3);
+    check_true(std::abs(mean(out)) < 2e-3f);
+    check_true(imageRatio(out) < initialImage/10);
+    check_true(imageRatio(out) < 0.01);
+
+    //reset restarts the automatic estimates
+    automatic.reset();
+    check_true(automatic.getDCOffset() == std::complex<double>());
+    check_true(automatic.getIQBalance() == std::complex<double>());
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Mixer converter
+ **********************************************************************/
+static int testMixerConverter(void)
+{
+    printf("Check mixer converter:\n");
+    const double frequency = 0.0123;
+    const double phase = 0.5;
+    std::vector<std::complex<float>> in(NUM_ELEMS, std::complex<float>(0.5f, 0.0f)), out(NUM_ELEMS), expected(NUM_ELEMS);
+    for (size_t i = 0; i < NUM_ELEMS; i++) expected[i] = std::complex<float>(std::polar(0.5, phase + TWO_PI*frequency*i));
+
+    //the phase continues from one call to the next
+    SoapySDR::MixerConverter mixer(SOAPY_SDR_CF32);
+    mixer.setFrequency(frequency);
+    mixer.setPhase(phase);
+    size_t offset = 0;
+    for (size_t i = 0; offset < NUM_ELEMS; i++)
+    {
+        const size_t n = std::min(CALL_SIZES[i % 5], NUM_ELEMS-offset);
+        mixer.convert(in.data()+offset, out.data()+offset, n);
+        offset += n;
+    }
+    check_true(maxError(out, expected) < 1e-4f);
+    check_true(std::abs(std::remainder(mixer.getPhase() - (phase + TWO_PI*frequency*NUM_ELEMS), TWO_PI)) < 1e-6);
+
+    //the phase wraps to [-pi, pi], and reset returns to zero
+    mixer.setPhase(3*TWO_PI + 1.0);
+    check_true(std::abs(mixer.getPhase() - 1.0) < 1e-9);
+    mixer.reset();
+    check_true(mixer.getPhase() == 0.0);
+
+    //mix before converting from CF32, and after converting to CF32
+    std::vector<int16_t> cs16(NUM_ELEMS*2);
+    SoapySDR::MixerConverter toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16);
+    toCS16.setFrequency(frequency);
+    toCS16.setPhase(phase);
+    toCS16.convert(in.data(), cs16.data(), NUM_ELEMS);
+    SoapySDR::MixerConverter fromCS16(SOAPY_SDR_CS16);
+    fromCS16.setFrequency(-frequency);
+    fromCS16.setPhase(-phase);
+    fromCS16.convert(cs16.data(), out.data(), NUM_ELEMS);
+    check_true(maxError(out, in) < 1e-3f);
+
+    //planar target and source, each plane offset per chunk
+    std::vector<float> planeI(NUM_ELEMS), planeQ(NUM_ELEMS);
+    void *planes[2] = {planeI.data(), planeQ.data()};
+    SoapySDR::MixerConverter toPlanar(SOAPY_SDR_CF32, SOAPY_SDR_CF32_PLANAR);
+    toPlanar.setFrequency(frequency);
+    toPlanar.setPhase(phase);
+    toPlanar.convert(in.data(), planes, NUM_ELEMS);
+    for (size_t i = 0; i < NUM_ELEMS; i++) out[i] = std::complex<float>(planeI[i], planeQ[i]);
+    check_true(maxError(out, expected) < 1e-4f);
+    SoapySDR::MixerConverter fromPlanar(SOAPY_SDR_CF32_PLANAR);
+    fromPlanar.setFrequency(-frequency);
+    fromPlanar.setPhase(-phase);
+    fromPlanar.convert(planes, out.data(), NUM_ELEMS);
+    check_true(maxError(out, in) < 1e-4f);
+
+    //without a CF32 side
+    bool threw = false;
+    try
+    {
+        SoapySDR::MixerConverter(SOAPY_SDR_CS16, SOAPY_SDR_CS8);
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    check_true(threw);
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Decimating converter
+ **********************************************************************/
+static std::vector<std::complex<float>> tone(const double frequency, const size_t numElems)
+{
+    std::vector<std::complex<float>> out(numElems);
+    for (size_t i = 0; i < numElems; i++) out[i] = std::complex<float>(std::polar(0.5, TWO_PI*frequency*i));
+    return out;
+}
+
+//decimate a buffer in calls of odd sizes
+static std::vector<std::complex<float>> decimate(SoapySDR::DecimatingConverter &decim, const std::vector<std::complex<float>> &in)
+{
+    std::vector<std::complex<float>> out(in.size());
+    size_t numIn = 0, numOut = 0;
+    for (size_t i = 0; numIn < in.size(); i++)
+    {
+        const size_t n = std::min(CALL_SIZES[i % 5], in.size()-numIn);
+        numOut += decim.convert(in.data()+numIn, out.data()+numOut, n);
+        numIn += n;
+    }
+    out.resize(numOut);
+    return out;
+}
+
+//the RMS amplitude of the output after the filters settle
+static double rms(const std::vector<std::complex<float>> &y)
+{
+    double power = 0.0;
+    for (size_t i = y.size()/4; i < y.size(); i++) power += std::norm(y[i]);
+    return std::sqrt(power/(y.size() - y.size()/4));
+}
+
+static int testDecimatingConverter(void)
+{
+    printf("Check decimating converter:\n");
+
+    //N inputs produce ceil(N/factor) outputs, however the calls are split
+    const auto in = tone(0.01, NUM_ELEMS*4);
+    for (const size_t factor : {1, 2, 3, 4, 5, 6, 8, 12})
+    {
+        SoapySDR::DecimatingConverter decim(SOAPY_SDR_CF32, factor);
+        printf("  factor %zu:\n", factor);
+        check_true(decimate(decim, in).size() == (in.size() + factor - 1)/factor);
+        decim.reset();
+        check_true(decim.convert(in.data(), std::vector<std::complex<float>>(in.size()).data(), 1) == 1);
+    }
+
+    //a tone in the passband keeps its amplitude, a tone that would alias is rejected
+    SoapySDR::DecimatingConverter halfBand(SOAPY_SDR_CF32, 4);
+    check_true(std::abs(rms(decimate(halfBand, tone(0.05, NUM_ELEMS*4))) - 0.5) < 0.005);
+    halfBand.reset();
+    check_true(rms(decimate(halfBand, tone(0.375, NUM_ELEMS*4))) < 0.5e-3);
+    SoapySDR::DecimatingConverter cic(SOAPY_SDR_CF32, 3);
+    check_true(std::abs(rms(decimate(cic, tone(0.005, NUM_ELEMS*4))) - 0.5) < 0.01);
+    cic.reset();
+    check_true(rms(decimate(cic, tone(1.0/3, NUM_ELEMS*4))) < 1e-3);
+
+    //tones that would alias into the inner 60% of the output band, across the band in steps of 1/64
+    for (const size_t factor : {2, 4, 8, 16})
+    {
+        printf("  alias rejection, factor %zu:\n", factor);
+        SoapySDR::DecimatingConverter decim(SOAPY_SDR_CF32, factor);
+        double worst = 0.0;
+        for (size_t k = 1; k < factor; k++)
+        {
+            for (int d = -32; d <= 32; d++)
+            {
+                decim.reset();
+                worst = std::max(worst, rms(decimate(decim, tone((k + 0.3*d/32)/factor, NUM_ELEMS*4))));
+            }
+        }
+        check_true(20*std::log10(worst/0.5) < -85.0);
+    }
+
+    //a planar source matches the interleaved source
+    std::vector<float> planeI(in.size()), planeQ(in.size());
+    for (size_t i = 0; i < in.size(); i++)
+    {
+        planeI[i] = in[i].real();
+        planeQ[i] = in[i].imag();
+    }
+    const void *planes[2] = {planeI.data(), planeQ.data()};
+    SoapySDR::DecimatingConverter interleaved(SOAPY_SDR_CF32, 6), planar(SOAPY_SDR_CF32_PLANAR, 6);
+    std::vector<std::complex<float>> expected(in.size()), out(in.size());
+    expected.resize(interleaved.convert(in.data(), expected.data(), in.size()));
+    out.resize(planar.convert(planes, out.data(), in.size()));
+    check_true(out.size() == expected.size());
+    check_true(maxError(out, expected) == 0.0f);
+
+    bool threw = false;
+    try
+    {
+        SoapySDR::DecimatingConverter(SOAPY_SDR_CF32, 0);
+    }
+    catch (const std::runtime_error &)
+    {
+        threw = true;
+    }
+    check_true(threw);
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Saturating converter
+ **********************************************************************/
+struct SaturatingCase
+{
+    const char *source;
+    const char *target;
+    size_t numParts;
+    double fullScale; //the registry scaling of a float source
+    int min, max; //the limits before the narrowing shift
+    int shift; //from 16 bits to 8 bits for an S16 source
+};
+
+static const SaturatingCase SATURATING_CASES[] = {
+    {SOAPY_SDR_F32, SOAPY_SDR_S16, 1, 32768.0, -32768, 32767, 0},
+    {SOAPY_SDR_CF32, SOAPY_SDR_CS16, 2, 32768.0, -32768, 32767, 0},
+    {SOAPY_SDR_F32, SOAPY_SDR_S8, 1, 128.0, -128, 127, 0},
+    {SOAPY_SDR_CF32, SOAPY_SDR_CS8, 2, 128.0, -128, 127, 0},
+    {SOAPY_SDR_F32, SOAPY_SDR_U8, 1, 128.0, -128, 127, 0},
+    {SOAPY_SDR_CF32, SOAPY_SDR_CU8, 2, 128.0, -128, 127, 0},
+    {SOAPY_SDR_S16, SOAPY_SDR_S8, 1, 1.0, -32768, 32767, 8},
+    {SOAPY_SDR_CS16, SOAPY_SDR_CS8, 2, 1.0, -32768, 32767, 8},
+};
+
+//a target part as a signed value, with the U8 offset removed
+static int targetPart(const std::vector<int8_t> &out8, const std::vector<int16_t> &out16, const std::string &target, const size_t i)
+{
+    if (target == SOAPY_SDR_S16 or target == SOAPY_SDR_CS16) return out16[i];
+    if (target == SOAPY_SDR_U8 or target == SOAPY_SDR_CU8) return int(uint8_t(out8[i])) - 128;
+    return out8[i];
+}
+
+static int testSaturatingConverter(void)
+{
+    printf("Check saturating converter:\n");
+    for (const auto &c : SATURATING_CASES)
+    {
+        printf("  %s to %s:\n", c.source, c.target);
+        const size_t numParts = NUM_ELEMS*c.numParts;
+        const bool floatSource = (c.shift == 0);
+
+        //a ramp to four times full scale in both directions
+        std::vector<float> srcF32(numParts);
+        std::vector<int16_t> srcS16(numParts);
+        for (size_t i = 0; i < numParts; i++)
+        {
+            srcF32[i] = float(-4.0 + 8.0*i/numParts);
+            srcS16[i] = int16_t(-32768 + (65536*i)/numParts);
+        }
+        const void *src = floatSource?(const void *)srcF32.data():(const void *)srcS16.data();
+
+        for (const double scaler : {1.0, 0.5, 4.0})
+        {
+            std::vector<int8_t> out8(numParts);
+            std::vector<int16_t> out16(numParts);
+            void *dst = (c.target == std::string(SOAPY_SDR_S16) or c.target == std::string(SOAPY_SDR_CS16))?(void *)out16.data():(void *)out8.data();
+
+            //split across calls, the count accumulates
+            SoapySDR::SaturatingConverter sat(c.source, c.target);
+            const size_t elemSize = SoapySDR::formatToSize(c.source), outSize = SoapySDR::formatToSize(c.target);
+            size_t numClipped = 0, numElems = 0;
+            for (size_t i = 0; numElems < NUM_ELEMS; i++)
+            {
+                const size_t n = std::min(CALL_SIZES[i % 5], NUM_ELEMS-numElems);
+                numClipped += sat.convert((const uint8_t *)src + numElems*elemSize, (uint8_t *)dst + numElems*outSize, n, scaler);
+                numElems += n;
+            }
+
+            size_t expectedClipped = 0;
+            int maxError = 0;
+            for (size_t i = 0; i < numParts; i++)
+            {
+                const float scaled = floatSource?srcF32[i]*float(scaler*c.fullScale):srcS16[i]*float(scaler);
+                if (scaled > c.max or scaled < c.min) expectedClipped++;
+                const int expected = int(std::min<float>(std::max<float>(scaled, c.min), c.max)) >> c.shift;
+                maxError = std::max(maxError, std::abs(targetPart(out8, out16, c.target, i) - expected));
+            }
+            check_true(maxError == 0);
+            check_true(numClipped == expectedClipped);
+            check_true(sat.getClipCount() == expectedClipped);
+            check_true(scaler < 4.0 or expectedClipped > 0);
+
+            sat.resetClipCount();
+            check_true(sat.getClipCount() == 0);
+            check_true(sat.convert(src, dst, NUM_ELEMS, scaler) == expectedClipped);
+            check_true(sat.getClipCount() == expectedClipped);
+        }
+    }
+
+    for (const auto &pair : {std::make_pair(SOAPY_SDR_F32, SOAPY_SDR_S32), std::make_pair(SOAPY_SDR_CS16, SOAPY_SDR_CF32), std::make_pair(SOAPY_SDR_CF32, SOAPY_SDR_S16)})
+    {
+        bool threw = false;
+        try
+        {
+            SoapySDR::SaturatingConverter(pair.first, pair.second);
+        }
+        catch (const std::runtime_error &)
+        {
+            threw = true;
+        }
+        check_true(threw);
+    }
+    return EXIT_SUCCESS;
+}
+
+int main(void)
+{
+    if (testIQCorrectionConverter() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testMixerConverter() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testDecimatingConverter() != EXIT_SUCCESS) return EXIT_FAILURE;
+    if (testSaturatingConverter() != EXIT_SUCCESS) return EXIT_FAILURE;
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
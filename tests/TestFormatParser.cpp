@@ -21,6 +21,7 @@ int main(void)
 
     formatCheck(SOAPY_SDR_CF64, 16);
     formatCheck(SOAPY_SDR_CF32, 8);
+    formatCheck(SOAPY_SDR_CF16, 4);
     formatCheck(SOAPY_SDR_CS32, 8);
     formatCheck(SOAPY_SDR_CU32, 8);
     formatCheck(SOAPY_SDR_CS16, 4);
@@ -34,6 +35,7 @@ int main(void)
 
     formatCheck(SOAPY_SDR_F64, 8);
     formatCheck(SOAPY_SDR_F32, 4);
+    formatCheck(SOAPY_SDR_F16, 2);
     formatCheck(SOAPY_SDR_S32, 4);
     formatCheck(SOAPY_SDR_U32, 4);
     formatCheck(SOAPY_SDR_S16, 2);